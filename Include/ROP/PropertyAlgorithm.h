@@ -0,0 +1,470 @@
+#pragma once
+#include <ROP/RunTimeObjectProperty.h>
+#include <limits>
+#include <cmath>
+
+// ==================== 对象集合上的属性算法 ====================
+// 对大量PropertyObject的同一属性做列式读写。属性元数据在FINALIZE_PROPERTY_SYSTEM后只读，
+// 算法按类解析一次元数据，之后对成员变量属性直接按字段偏移访问，不再逐个对象查找属性、构造Property
+
+namespace ROP
+{
+    // 属性算法内部工具
+    // ObjectBase为PropertyObject的具体实例化类型（即各类中的ROPObjectType）
+    template<typename ObjectBase>
+    class PropertyAlgorithmUtils
+    {
+    public:
+        using MetaType = typename ObjectBase::ROPPropertyMeta;
+        using PropertyDataType = typename ObjectBase::ROPPropertyDataType;
+
+        // 在指定类的属性数据中按ID解析元数据，并校验注册类型为T（ID越界或类型不匹配时报告错误并抛出异常）
+        template<typename T>
+        static const MetaType* ResolveMeta(const PropertyDataType& propertyData, PropertyId id)
+        {
+            if (id >= propertyData.propertyIdTable.size())
+            {
+                ObjectBase::ReportError(PropertyErrorKind::InvalidProperty, "Invalid property id: property does not exist in object class");
+                throw std::runtime_error("Invalid property id: property does not exist in object class");
+            }
+            const MetaType* meta = propertyData.propertyIdTable[id];
+            CheckMetaType<T>(meta);
+            return meta;
+        }
+
+        // 校验访问器有效且注册类型为T
+        template<typename T>
+        static const MetaType* ResolveMeta(const typename ObjectBase::ROPPropertyAccessor& accessor)
+        {
+            const MetaType* meta = accessor.GetMeta();
+            if (!meta)
+            {
+                ObjectBase::ReportError(PropertyErrorKind::InvalidProperty, "Invalid property accessor");
+                throw std::runtime_error("Invalid property accessor");
+            }
+            CheckMetaType<T>(meta);
+            return meta;
+        }
+
+    private:
+        template<typename T>
+        static void CheckMetaType(const MetaType* meta)
+        {
+            if (PropertyTypeCheckEnabled && !meta->template IsType<T>())
+            {
+                ObjectBase::ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: column access");
+                throw std::runtime_error("Property type mismatch: column access");
+            }
+        }
+    };
+
+    // ==================== 列式读取 ====================
+
+    // 把objects中每个对象的同一属性依次复制到out[0, objects.size())
+    // id为属性ID，对解析该ID的类及其子类的对象都有效；对象可以属于不同的类，
+    // 连续属于同一类的对象复用已解析的元数据，成员变量属性按字段偏移直接读取
+    template<typename T, typename ObjectType>
+    void Gather(PropertySpan<ObjectType* const> objects, PropertyId id, T* out)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        using Utils = PropertyAlgorithmUtils<ObjectBase>;
+
+        size_t index = 0;
+        while (index < objects.size())
+        {
+            // 解析当前这一段同类对象的元数据
+            const typename Utils::PropertyDataType* classData = &objects[index]->GetPropertyData();
+            const typename Utils::MetaType* meta = Utils::template ResolveMeta<T>(*classData, id);
+
+            if (!meta->isCustomAccessor)
+            {
+                const ptrdiff_t fieldOffset = meta->fieldOffset;
+                do
+                {
+                    const ObjectBase* obj = objects[index];
+                    out[index] = *reinterpret_cast<const T*>(reinterpret_cast<const char*>(obj) + fieldOffset);
+                    ++index;
+                } while (index < objects.size() && &objects[index]->GetPropertyData() == classData);
+            }
+            else
+            {
+                do
+                {
+                    out[index] = *static_cast<const T*>(meta->getter(objects[index]));
+                    ++index;
+                } while (index < objects.size() && &objects[index]->GetPropertyData() == classData);
+            }
+        }
+    }
+
+    template<typename T, typename ObjectType>
+    void Gather(const std::vector<ObjectType*>& objects, PropertyId id, T* out)
+    {
+        Gather(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id, out);
+    }
+
+    // 使用类级属性访问器读取：所有对象必须是访问器所属类或其子类的实例（不逐个对象检查）
+    // 不需要逐个对象查询类信息，成员变量属性是纯粹的按偏移读取循环
+    template<typename T, typename ObjectType>
+    void Gather(PropertySpan<ObjectType* const> objects, const typename ObjectType::ROPPropertyAccessor& accessor, T* out)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        using Utils = PropertyAlgorithmUtils<ObjectBase>;
+
+        const typename Utils::MetaType* meta = Utils::template ResolveMeta<T>(accessor);
+        if (!meta->isCustomAccessor)
+        {
+            const ptrdiff_t fieldOffset = meta->fieldOffset;
+            for (size_t i = 0; i < objects.size(); ++i)
+            {
+                const ObjectBase* obj = objects[i];
+                out[i] = *reinterpret_cast<const T*>(reinterpret_cast<const char*>(obj) + fieldOffset);
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            out[i] = *static_cast<const T*>(meta->getter(objects[i]));
+        }
+    }
+
+    template<typename T, typename ObjectType>
+    void Gather(const std::vector<ObjectType*>& objects, const typename ObjectType::ROPPropertyAccessor& accessor, T* out)
+    {
+        Gather(PropertySpan<ObjectType* const>(objects.data(), objects.size()), accessor, out);
+    }
+
+    // ==================== 列式写入 ====================
+
+    // 把values[0, objects.size())依次写入objects中每个对象的同一属性（Gather的逆操作）
+    // 成员变量属性按字段偏移直接赋值；自定义访问器属性对每段同类对象只解析一次setter，
+    // 逐个对象传入values[i]的副本（setter可以从副本中移动）
+    template<typename T, typename ObjectType>
+    void Scatter(PropertySpan<ObjectType* const> objects, PropertyId id, const T* values)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        using Utils = PropertyAlgorithmUtils<ObjectBase>;
+
+        size_t index = 0;
+        while (index < objects.size())
+        {
+            // 解析当前这一段同类对象的元数据
+            const typename Utils::PropertyDataType* classData = &objects[index]->GetPropertyData();
+            const typename Utils::MetaType* meta = Utils::template ResolveMeta<T>(*classData, id);
+
+            if (!meta->isCustomAccessor)
+            {
+                const ptrdiff_t fieldOffset = meta->fieldOffset;
+                do
+                {
+                    ObjectBase* obj = objects[index];
+                    *reinterpret_cast<T*>(reinterpret_cast<char*>(obj) + fieldOffset) = values[index];
+                    ++index;
+                } while (index < objects.size() && &objects[index]->GetPropertyData() == classData);
+            }
+            else
+            {
+                const auto& setter = meta->setter;
+                do
+                {
+                    T temp = values[index];
+                    setter(objects[index], &temp);
+                    ++index;
+                } while (index < objects.size() && &objects[index]->GetPropertyData() == classData);
+            }
+        }
+    }
+
+    template<typename T, typename ObjectType>
+    void Scatter(const std::vector<ObjectType*>& objects, PropertyId id, const T* values)
+    {
+        Scatter(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id, values);
+    }
+
+    // 使用类级属性访问器写入：所有对象必须是访问器所属类或其子类的实例（不逐个对象检查）
+    template<typename T, typename ObjectType>
+    void Scatter(PropertySpan<ObjectType* const> objects, const typename ObjectType::ROPPropertyAccessor& accessor, const T* values)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        using Utils = PropertyAlgorithmUtils<ObjectBase>;
+
+        const typename Utils::MetaType* meta = Utils::template ResolveMeta<T>(accessor);
+        if (!meta->isCustomAccessor)
+        {
+            const ptrdiff_t fieldOffset = meta->fieldOffset;
+            for (size_t i = 0; i < objects.size(); ++i)
+            {
+                ObjectBase* obj = objects[i];
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(obj) + fieldOffset) = values[i];
+            }
+            return;
+        }
+
+        const auto& setter = meta->setter;
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            T temp = values[i];
+            setter(objects[i], &temp);
+        }
+    }
+
+    template<typename T, typename ObjectType>
+    void Scatter(const std::vector<ObjectType*>& objects, const typename ObjectType::ROPPropertyAccessor& accessor, const T* values)
+    {
+        Scatter(PropertySpan<ObjectType* const>(objects.data(), objects.size()), accessor, values);
+    }
+
+    // ==================== 数值属性聚合 ====================
+    // 聚合先用Gather把一段对象（PropertyAggregateChunkSize个）的属性读到栈上的连续缓冲区，
+    // 再在缓冲区上运行内核。求和内核使用PropertyAggregateLaneCount个互相独立的累加通道，
+    // 每个通道只做顺序加法，不需要重结合，因此在严格浮点语义下编译器也能把各通道合并为向量加法
+
+    constexpr size_t PropertyAggregateChunkSize = 1024;
+
+    // 求和内核的累加通道数（覆盖AVX的8个float或两条4个double的向量）
+    constexpr size_t PropertyAggregateLaneCount = 8;
+
+    // 聚合结果类型：有符号整数属性用int64_t求和，无符号整数属性用uint64_t求和，浮点属性用double求和
+    template<typename T>
+    using PropertySumType = std::conditional_t<std::is_integral_v<T>,
+        std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, double>;
+
+    // 数值属性的统计结果
+    // min/max跳过NaN（与Histogram一致），集合为空或全为NaN时为T{}；sum按IEEE语义累加，含NaN时为NaN；count包括NaN
+    template<typename T>
+    struct PropertyStatistics
+    {
+        size_t count = 0;
+        PropertySumType<T> sum = PropertySumType<T>();
+        T min = T();
+        T max = T();
+
+        double Mean() const
+        {
+            return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+        }
+    };
+
+    // 连续数据上的聚合内核
+    template<typename T>
+    struct PropertyAggregateKernels
+    {
+        static_assert(std::is_arithmetic_v<T>, "Property aggregates require an arithmetic property type");
+
+        // 累加通道的类型：浮点属性在自身精度的通道中累加（float通道才能以8路向量执行），整数属性直接在求和类型中累加
+        using LaneType = std::conditional_t<std::is_floating_point_v<T>, T, PropertySumType<T>>;
+
+        // 求和：按PropertyAggregateChunkSize分块，块内在PropertyAggregateLaneCount个通道中累加，
+        // 每块结束后把通道合并到求和类型中（float通道每个最多累加chunk/lane个值，限制精度损失）
+        static PropertySumType<T> Sum(const T* data, size_t count)
+        {
+            PropertySumType<T> sum = 0;
+            for (size_t blockBegin = 0; blockBegin < count; blockBegin += PropertyAggregateChunkSize)
+            {
+                const size_t blockEnd = std::min(count, blockBegin + PropertyAggregateChunkSize);
+                LaneType lanes[PropertyAggregateLaneCount] = {};
+                size_t i = blockBegin;
+                for (; i + PropertyAggregateLaneCount <= blockEnd; i += PropertyAggregateLaneCount)
+                {
+                    for (size_t lane = 0; lane < PropertyAggregateLaneCount; ++lane)
+                    {
+                        lanes[lane] += static_cast<LaneType>(data[i + lane]);
+                    }
+                }
+                for (size_t lane = 0; lane < PropertyAggregateLaneCount; ++lane)
+                {
+                    sum += static_cast<PropertySumType<T>>(lanes[lane]);
+                }
+                for (; i < blockEnd; ++i)
+                {
+                    sum += static_cast<PropertySumType<T>>(data[i]);
+                }
+            }
+            return sum;
+        }
+
+        // 求最小值和最大值，跳过NaN；没有非NaN的值时返回false且不修改minValue/maxValue
+        // 从第一个非NaN值开始，之后NaN与任何值比较都为false，条件选择自然保留原值
+        static bool MinMax(const T* data, size_t count, T& minValue, T& maxValue)
+        {
+            size_t first = 0;
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                while (first < count && std::isnan(data[first]))
+                    ++first;
+            }
+            if (first == count)
+                return false;
+
+            T mn = data[first];
+            T mx = data[first];
+            for (size_t i = first + 1; i < count; ++i)
+            {
+                const T value = data[i];
+                mn = value < mn ? value : mn;
+                mx = value > mx ? value : mx;
+            }
+            minValue = mn;
+            maxValue = mx;
+            return true;
+        }
+
+        // 直方图：[minValue, maxValue]等分为binCount个桶，超出范围的值（包括无穷大）计入首尾桶，NaN被跳过
+        // 返回跳过的NaN数量（调用方保证minValue <= maxValue且binCount大于0）
+        static size_t Histogram(const T* data, size_t count, double minValue, double maxValue, size_t* bins, size_t binCount)
+        {
+            const double scale = maxValue > minValue ? static_cast<double>(binCount) / (maxValue - minValue) : 0.0;
+            const double lastBin = static_cast<double>(binCount - 1);
+            size_t skipped = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const double value = static_cast<double>(data[i]);
+                if (std::isnan(value))
+                {
+                    ++skipped;
+                    continue;
+                }
+                // 写成“不大于0则取0”，使无穷大乘以0得到的NaN也落入首桶，转换为size_t前位置一定在[0, lastBin]内
+                double position = (value - minValue) * scale;
+                position = position > 0.0 ? position : 0.0;
+                position = position < lastBin ? position : lastBin;
+                ++bins[static_cast<size_t>(position)];
+            }
+            return skipped;
+        }
+    };
+
+    // 把objects的属性分段读到缓冲区，对每段调用fn(const T* data, size_t count)
+    template<typename T, typename ObjectType, typename ChunkFunc>
+    void ForEachPropertyChunk(PropertySpan<ObjectType* const> objects, PropertyId id, ChunkFunc&& fn)
+    {
+        T buffer[PropertyAggregateChunkSize];
+        for (size_t begin = 0; begin < objects.size(); begin += PropertyAggregateChunkSize)
+        {
+            const size_t count = std::min(PropertyAggregateChunkSize, objects.size() - begin);
+            Gather(PropertySpan<ObjectType* const>(objects.data() + begin, count), id, buffer);
+            fn(static_cast<const T*>(buffer), count);
+        }
+    }
+
+    // 一次遍历计算数量、和、最小值、最大值
+    template<typename T, typename ObjectType>
+    PropertyStatistics<T> ComputeStatistics(PropertySpan<ObjectType* const> objects, PropertyId id)
+    {
+        PropertyStatistics<T> stats;
+        bool hasMinMax = false;
+        ForEachPropertyChunk<T>(objects, id, [&stats, &hasMinMax](const T* data, size_t count)
+            {
+                T chunkMin;
+                T chunkMax;
+                if (PropertyAggregateKernels<T>::MinMax(data, count, chunkMin, chunkMax))
+                {
+                    stats.min = !hasMinMax || chunkMin < stats.min ? chunkMin : stats.min;
+                    stats.max = !hasMinMax || chunkMax > stats.max ? chunkMax : stats.max;
+                    hasMinMax = true;
+                }
+                stats.sum += PropertyAggregateKernels<T>::Sum(data, count);
+                stats.count += count;
+            });
+        return stats;
+    }
+
+    template<typename T, typename ObjectType>
+    PropertyStatistics<T> ComputeStatistics(const std::vector<ObjectType*>& objects, PropertyId id)
+    {
+        return ComputeStatistics<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id);
+    }
+
+    // 求和
+    template<typename T, typename ObjectType>
+    PropertySumType<T> Sum(PropertySpan<ObjectType* const> objects, PropertyId id)
+    {
+        PropertySumType<T> sum = 0;
+        ForEachPropertyChunk<T>(objects, id, [&sum](const T* data, size_t count)
+            {
+                sum += PropertyAggregateKernels<T>::Sum(data, count);
+            });
+        return sum;
+    }
+
+    template<typename T, typename ObjectType>
+    PropertySumType<T> Sum(const std::vector<ObjectType*>& objects, PropertyId id)
+    {
+        return Sum<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id);
+    }
+
+    // 最小值（跳过NaN，集合为空或全为NaN时返回T{}）
+    template<typename T, typename ObjectType>
+    T Min(PropertySpan<ObjectType* const> objects, PropertyId id)
+    {
+        return ComputeStatistics<T>(objects, id).min;
+    }
+
+    template<typename T, typename ObjectType>
+    T Min(const std::vector<ObjectType*>& objects, PropertyId id)
+    {
+        return Min<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id);
+    }
+
+    // 最大值（跳过NaN，集合为空或全为NaN时返回T{}）
+    template<typename T, typename ObjectType>
+    T Max(PropertySpan<ObjectType* const> objects, PropertyId id)
+    {
+        return ComputeStatistics<T>(objects, id).max;
+    }
+
+    template<typename T, typename ObjectType>
+    T Max(const std::vector<ObjectType*>& objects, PropertyId id)
+    {
+        return Max<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id);
+    }
+
+    // 平均值（集合为空时返回0）
+    template<typename T, typename ObjectType>
+    double Mean(PropertySpan<ObjectType* const> objects, PropertyId id)
+    {
+        return objects.empty() ? 0.0 : static_cast<double>(Sum<T>(objects, id)) / static_cast<double>(objects.size());
+    }
+
+    template<typename T, typename ObjectType>
+    double Mean(const std::vector<ObjectType*>& objects, PropertyId id)
+    {
+        return Mean<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id);
+    }
+
+    // 直方图：[minValue, maxValue]等分为binCount个桶，超出范围的值（包括无穷大）计入首尾桶
+    // NaN值不计入任何桶，数量写入skippedCount（可为空）；minValue大于maxValue或任一边界为NaN时报告错误并抛出异常
+    template<typename T, typename ObjectType>
+    std::vector<size_t> Histogram(PropertySpan<ObjectType* const> objects, PropertyId id, double minValue, double maxValue, size_t binCount,
+        size_t* skippedCount = nullptr)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+
+        if (!(minValue <= maxValue))
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Invalid histogram range: minValue must not exceed maxValue");
+            throw std::runtime_error("Invalid histogram range: minValue must not exceed maxValue");
+        }
+
+        std::vector<size_t> bins(binCount, 0);
+        size_t skipped = 0;
+        if (binCount != 0)
+        {
+            ForEachPropertyChunk<T>(objects, id, [&](const T* data, size_t count)
+                {
+                    skipped += PropertyAggregateKernels<T>::Histogram(data, count, minValue, maxValue, bins.data(), binCount);
+                });
+        }
+        if (skippedCount)
+            *skippedCount = skipped;
+        return bins;
+    }
+
+    template<typename T, typename ObjectType>
+    std::vector<size_t> Histogram(const std::vector<ObjectType*>& objects, PropertyId id, double minValue, double maxValue, size_t binCount,
+        size_t* skippedCount = nullptr)
+    {
+        return Histogram<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), id, minValue, maxValue, binCount, skippedCount);
+    }
+}
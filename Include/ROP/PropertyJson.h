@@ -0,0 +1,782 @@
+#pragma once
+#include <ROP/RunTimeObjectProperty.h>
+#include <charconv>
+#include <limits>
+
+// ==================== JSON读写 ====================
+// ToJson把对象的属性直接追加写入调用方的字符串缓冲区，FromJson用SAX方式解析JSON并按属性名称索引分发到属性，不构建DOM。
+// 每个类在第一次使用时构建一次JSON计划：预先转义好的键字面量、按类型实例化的读写函数、选项属性合并后的选项列表。
+// 数字使用to_chars/from_chars格式化和解析；选项属性按选项字符串读写（与GetOptionString/SetOptionByString一致）。
+// 支持的属性类型：bool、整数、浮点数、字符串，其他类型的属性不参与JSON读写
+
+namespace ROP
+{
+    // SAX解析器产生的标量值
+    struct PropertyJsonValue
+    {
+        enum class Kind : uint8_t
+        {
+            Null,
+            Bool,
+            Number,
+            String
+        };
+
+        Kind kind = Kind::Null;
+        bool boolValue = false;
+        std::string_view text;     // Number为原始数字文本，String为解码后的字符串（只在回调期间有效）
+    };
+
+    // JSON格式化工具
+    struct PropertyJsonUtils
+    {
+        // 追加带引号的转义字符串（输入按UTF-8原样输出，只转义引号、反斜杠和控制字符）
+        static void AppendString(std::string& out, std::string_view text)
+        {
+            static const char hexDigits[] = "0123456789abcdef";
+            out.push_back('"');
+            size_t runStart = 0;
+            for (size_t i = 0; i < text.size(); ++i)
+            {
+                const unsigned char c = static_cast<unsigned char>(text[i]);
+                if (c >= 0x20 && c != '"' && c != '\\')
+                    continue;
+
+                out.append(text.data() + runStart, i - runStart);
+                runStart = i + 1;
+                switch (c)
+                {
+                case '"': out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\n': out.append("\\n"); break;
+                case '\r': out.append("\\r"); break;
+                case '\t': out.append("\\t"); break;
+                case '\b': out.append("\\b"); break;
+                case '\f': out.append("\\f"); break;
+                default:
+                {
+                    const char escaped[] = { '\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF] };
+                    out.append(escaped, sizeof(escaped));
+                    break;
+                }
+                }
+            }
+            out.append(text.data() + runStart, text.size() - runStart);
+            out.push_back('"');
+        }
+
+        // 追加数字（浮点数使用可精确往返的最短表示，非有限值输出null）
+        template<typename T>
+        static void AppendNumber(std::string& out, T value)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                if (!(value == value) || value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+                {
+                    out.append("null");
+                    return;
+                }
+            }
+
+            char buffer[64];
+            const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, result.ptr);
+        }
+    };
+
+    // SAX风格的JSON解析器：边解析边回调Handler，不构建DOM
+    // Handler需要提供以下成员函数，返回false时中止解析：
+    // bool StartObject(); bool EndObject(); bool StartArray(); bool EndArray();
+    // bool Key(std::string_view key); bool Value(const PropertyJsonValue& value);
+    // 回调收到的字符串视图只在回调期间有效（不含转义的字符串直接指向输入，含转义的解码到解析器的内部缓冲区）
+    class PropertyJsonSaxParser
+    {
+    public:
+        // 最大嵌套深度
+        static constexpr size_t MaxDepth = 256;
+
+        // 解析一个完整的JSON文本；语法错误或Handler中止时返回false
+        template<typename Handler>
+        bool Parse(std::string_view json, Handler& handler)
+        {
+            m_begin = json.data();
+            m_cursor = m_begin;
+            m_end = m_begin + json.size();
+
+            SkipWhitespace();
+            if (!ParseValue(handler, 0))
+                return false;
+            SkipWhitespace();
+            return m_cursor == m_end;
+        }
+
+        // 出错位置（相对于输入开头的字节偏移）
+        size_t GetErrorOffset() const
+        {
+            return static_cast<size_t>(m_cursor - m_begin);
+        }
+
+    private:
+        template<typename Handler>
+        bool ParseValue(Handler& handler, size_t depth)
+        {
+            if (m_cursor == m_end)
+                return false;
+
+            switch (*m_cursor)
+            {
+            case '{':
+                return ParseObject(handler, depth + 1);
+            case '[':
+                return ParseArray(handler, depth + 1);
+            case '"':
+            {
+                PropertyJsonValue value;
+                value.kind = PropertyJsonValue::Kind::String;
+                return ParseString(value.text) && handler.Value(value);
+            }
+            case 't':
+                return ParseLiteral("true", PropertyJsonValue::Kind::Bool, true, handler);
+            case 'f':
+                return ParseLiteral("false", PropertyJsonValue::Kind::Bool, false, handler);
+            case 'n':
+                return ParseLiteral("null", PropertyJsonValue::Kind::Null, false, handler);
+            default:
+            {
+                PropertyJsonValue value;
+                value.kind = PropertyJsonValue::Kind::Number;
+                return ParseNumber(value.text) && handler.Value(value);
+            }
+            }
+        }
+
+        template<typename Handler>
+        bool ParseObject(Handler& handler, size_t depth)
+        {
+            if (depth > MaxDepth || !handler.StartObject())
+                return false;
+            ++m_cursor;
+            SkipWhitespace();
+            if (m_cursor != m_end && *m_cursor == '}')
+            {
+                ++m_cursor;
+                return handler.EndObject();
+            }
+
+            for (;;)
+            {
+                std::string_view key;
+                if (m_cursor == m_end || *m_cursor != '"' || !ParseString(key) || !handler.Key(key))
+                    return false;
+                SkipWhitespace();
+                if (m_cursor == m_end || *m_cursor != ':')
+                    return false;
+                ++m_cursor;
+                SkipWhitespace();
+                if (!ParseValue(handler, depth))
+                    return false;
+                SkipWhitespace();
+                if (m_cursor == m_end)
+                    return false;
+                if (*m_cursor == '}')
+                {
+                    ++m_cursor;
+                    return handler.EndObject();
+                }
+                if (*m_cursor != ',')
+                    return false;
+                ++m_cursor;
+                SkipWhitespace();
+            }
+        }
+
+        template<typename Handler>
+        bool ParseArray(Handler& handler, size_t depth)
+        {
+            if (depth > MaxDepth || !handler.StartArray())
+                return false;
+            ++m_cursor;
+            SkipWhitespace();
+            if (m_cursor != m_end && *m_cursor == ']')
+            {
+                ++m_cursor;
+                return handler.EndArray();
+            }
+
+            for (;;)
+            {
+                if (!ParseValue(handler, depth))
+                    return false;
+                SkipWhitespace();
+                if (m_cursor == m_end)
+                    return false;
+                if (*m_cursor == ']')
+                {
+                    ++m_cursor;
+                    return handler.EndArray();
+                }
+                if (*m_cursor != ',')
+                    return false;
+                ++m_cursor;
+                SkipWhitespace();
+            }
+        }
+
+        template<typename Handler>
+        bool ParseLiteral(std::string_view literal, PropertyJsonValue::Kind kind, bool boolValue, Handler& handler)
+        {
+            if (static_cast<size_t>(m_end - m_cursor) < literal.size() || std::string_view(m_cursor, literal.size()) != literal)
+                return false;
+            m_cursor += literal.size();
+
+            PropertyJsonValue value;
+            value.kind = kind;
+            value.boolValue = boolValue;
+            return handler.Value(value);
+        }
+
+        // 按JSON数字语法检查并返回原始文本：-?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+        bool ParseNumber(std::string_view& text)
+        {
+            const char* start = m_cursor;
+            if (m_cursor != m_end && *m_cursor == '-')
+                ++m_cursor;
+            if (m_cursor == m_end || !IsDigit(*m_cursor))
+                return false;
+            if (*m_cursor == '0')
+                ++m_cursor;
+            else
+                SkipDigits();
+
+            if (m_cursor != m_end && *m_cursor == '.')
+            {
+                ++m_cursor;
+                if (m_cursor == m_end || !IsDigit(*m_cursor))
+                    return false;
+                SkipDigits();
+            }
+            if (m_cursor != m_end && (*m_cursor == 'e' || *m_cursor == 'E'))
+            {
+                ++m_cursor;
+                if (m_cursor != m_end && (*m_cursor == '+' || *m_cursor == '-'))
+                    ++m_cursor;
+                if (m_cursor == m_end || !IsDigit(*m_cursor))
+                    return false;
+                SkipDigits();
+            }
+
+            text = std::string_view(start, static_cast<size_t>(m_cursor - start));
+            return true;
+        }
+
+        // 解析字符串（m_cursor指向开头的引号）
+        bool ParseString(std::string_view& text)
+        {
+            ++m_cursor;
+            const char* start = m_cursor;
+            while (m_cursor != m_end && *m_cursor != '"' && *m_cursor != '\\')
+            {
+                if (static_cast<unsigned char>(*m_cursor) < 0x20)
+                    return false;
+                ++m_cursor;
+            }
+            if (m_cursor == m_end)
+                return false;
+            if (*m_cursor == '"')
+            {
+                text = std::string_view(start, static_cast<size_t>(m_cursor - start));
+                ++m_cursor;
+                return true;
+            }
+
+            // 含转义字符：解码到内部缓冲区
+            m_scratch.assign(start, m_cursor);
+            while (m_cursor != m_end && *m_cursor != '"')
+            {
+                const char c = *m_cursor++;
+                if (static_cast<unsigned char>(c) < 0x20)
+                    return false;
+                if (c != '\\')
+                {
+                    m_scratch.push_back(c);
+                    continue;
+                }
+                if (m_cursor == m_end)
+                    return false;
+
+                switch (*m_cursor++)
+                {
+                case '"': m_scratch.push_back('"'); break;
+                case '\\': m_scratch.push_back('\\'); break;
+                case '/': m_scratch.push_back('/'); break;
+                case 'b': m_scratch.push_back('\b'); break;
+                case 'f': m_scratch.push_back('\f'); break;
+                case 'n': m_scratch.push_back('\n'); break;
+                case 'r': m_scratch.push_back('\r'); break;
+                case 't': m_scratch.push_back('\t'); break;
+                case 'u':
+                    if (!ParseUnicodeEscape())
+                        return false;
+                    break;
+                default:
+                    return false;
+                }
+            }
+            if (m_cursor == m_end)
+                return false;
+            ++m_cursor;
+            text = m_scratch;
+            return true;
+        }
+
+        // 解析\uXXXX（m_cursor指向u之后），包括代理对，以UTF-8写入内部缓冲区
+        bool ParseUnicodeEscape()
+        {
+            uint32_t codePoint = 0;
+            if (!ParseHex4(codePoint))
+                return false;
+
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+            {
+                uint32_t low = 0;
+                if (m_end - m_cursor < 2 || m_cursor[0] != '\\' || m_cursor[1] != 'u')
+                    return false;
+                m_cursor += 2;
+                if (!ParseHex4(low) || low < 0xDC00 || low > 0xDFFF)
+                    return false;
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+            {
+                return false;
+            }
+
+            if (codePoint < 0x80)
+            {
+                m_scratch.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800)
+            {
+                m_scratch.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                m_scratch.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000)
+            {
+                m_scratch.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                m_scratch.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                m_scratch.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else
+            {
+                m_scratch.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                m_scratch.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                m_scratch.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                m_scratch.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            return true;
+        }
+
+        bool ParseHex4(uint32_t& value)
+        {
+            if (m_end - m_cursor < 4)
+                return false;
+            for (int i = 0; i < 4; ++i)
+            {
+                const char c = *m_cursor++;
+                value <<= 4;
+                if (c >= '0' && c <= '9')
+                    value |= static_cast<uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    value |= static_cast<uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    value |= static_cast<uint32_t>(c - 'A' + 10);
+                else
+                    return false;
+            }
+            return true;
+        }
+
+        static bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        void SkipDigits()
+        {
+            while (m_cursor != m_end && IsDigit(*m_cursor))
+                ++m_cursor;
+        }
+
+        void SkipWhitespace()
+        {
+            while (m_cursor != m_end && (*m_cursor == ' ' || *m_cursor == '\n' || *m_cursor == '\r' || *m_cursor == '\t'))
+                ++m_cursor;
+        }
+
+        const char* m_begin = nullptr;
+        const char* m_cursor = nullptr;
+        const char* m_end = nullptr;
+        std::string m_scratch;
+    };
+
+    // 属性类型的JSON编解码
+    template<typename T, typename = void>
+    struct PropertyJsonCodec
+    {
+        static constexpr bool Supported = false;
+    };
+
+    template<>
+    struct PropertyJsonCodec<bool>
+    {
+        static constexpr bool Supported = true;
+
+        static void Write(const bool& value, std::string& out)
+        {
+            out.append(value ? "true" : "false");
+        }
+
+        static bool Read(bool& value, const PropertyJsonValue& json)
+        {
+            if (json.kind != PropertyJsonValue::Kind::Bool)
+                return false;
+            value = json.boolValue;
+            return true;
+        }
+    };
+
+    template<typename T>
+    struct PropertyJsonCodec<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+    {
+        static constexpr bool Supported = true;
+
+        static void Write(const T& value, std::string& out)
+        {
+            PropertyJsonUtils::AppendNumber(out, value);
+        }
+
+        // 整数属性只接受可以无损表示的整数文本
+        static bool Read(T& value, const PropertyJsonValue& json)
+        {
+            if (json.kind != PropertyJsonValue::Kind::Number)
+                return false;
+            const char* last = json.text.data() + json.text.size();
+            const std::from_chars_result result = std::from_chars(json.text.data(), last, value);
+            return result.ec == std::errc() && result.ptr == last;
+        }
+    };
+
+    template<typename Traits, typename Alloc>
+    struct PropertyJsonCodec<std::basic_string<char, Traits, Alloc>>
+    {
+        static constexpr bool Supported = true;
+
+        static void Write(const std::basic_string<char, Traits, Alloc>& value, std::string& out)
+        {
+            PropertyJsonUtils::AppendString(out, std::string_view(value.data(), value.size()));
+        }
+
+        static bool Read(std::basic_string<char, Traits, Alloc>& value, const PropertyJsonValue& json)
+        {
+            if (json.kind != PropertyJsonValue::Kind::String)
+                return false;
+            value.assign(json.text.data(), json.text.size());
+            return true;
+        }
+    };
+
+    // 单个类的JSON计划（ObjectBase为PropertyObject的具体实例化类型，即各类中的ROPObjectType）
+    template<typename ObjectBase>
+    class PropertyJsonPlan
+    {
+    public:
+        using MetaType = typename ObjectBase::ROPPropertyMeta;
+        using PropertyDataType = typename ObjectBase::ROPPropertyDataType;
+        using StringType = typename ObjectBase::ROPStringType;
+
+        static_assert(std::is_convertible_v<const typename ObjectBase::ROPKeyType&, std::string_view>,
+            "JSON binding requires property names convertible to std::string_view");
+        static_assert(std::is_convertible_v<const StringType&, std::string_view>,
+            "JSON binding requires option strings convertible to std::string_view");
+
+        struct Entry
+        {
+            const MetaType* meta = nullptr;
+            std::string keyLiteral;                      // 预先转义的 "name":
+            std::vector<StringType> options;             // 选项属性合并后的选项列表（本类在前，父类在后，去重）
+            void (*write)(const Entry& entry, ObjectBase& obj, std::string& out) = nullptr;
+            bool (*read)(const Entry& entry, ObjectBase& obj, const PropertyJsonValue& value) = nullptr;
+        };
+
+        // 获取指定类的JSON计划（首次使用时构建，之后只读）
+        static const PropertyJsonPlan& Get(const PropertyDataType& classData)
+        {
+            return classData.planStorage.template GetOrCreate<PropertyJsonPlan>(classData);
+        }
+
+        explicit PropertyJsonPlan(const PropertyDataType& classData)
+            : m_classData(&classData), m_entryById(classData.propertyIdTable.size(), nullptr)
+        {
+            // 同名属性只输出最靠近子类的那个（与按名称访问属性的结果一致）
+            for (const auto* meta : classData.allPropertiesList.Pointers())
+            {
+                if (classData.propertyNameIndex.Find(meta->name) != meta->propertyId)
+                    continue;
+
+                Entry entry;
+                entry.meta = meta;
+                if (meta->isOptional && meta->readOptionIndex)
+                {
+                    entry.options = BuildOptionList(classData, *meta);
+                    entry.write = &WriteOption;
+                    entry.read = &ReadOption;
+                }
+                else if (!BindCodec<bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int,
+                    long, unsigned long, long long, unsigned long long, float, double, long double, std::string>(entry))
+                {
+                    continue;
+                }
+
+                PropertyJsonUtils::AppendString(entry.keyLiteral, std::string_view(meta->name));
+                entry.keyLiteral.push_back(':');
+                m_entries.push_back(std::move(entry));
+            }
+
+            for (const Entry& entry : m_entries)
+            {
+                m_entryById[entry.meta->propertyId] = &entry;
+            }
+        }
+
+        // 把对象写为一个JSON对象，追加到out末尾
+        void Write(ObjectBase& obj, std::string& out) const
+        {
+            out.push_back('{');
+            bool first = true;
+            for (const Entry& entry : m_entries)
+            {
+                if (!first)
+                    out.push_back(',');
+                first = false;
+                out.append(entry.keyLiteral);
+                entry.write(entry, obj, out);
+            }
+            out.push_back('}');
+        }
+
+        // 按属性名称查找条目（属性不存在或类型不参与JSON读写时返回nullptr）
+        const Entry* FindEntry(std::string_view name) const
+        {
+            const PropertyId id = m_classData->propertyNameIndex.Find(name);
+            return id < m_entryById.size() ? m_entryById[id] : nullptr;
+        }
+
+        // 参与JSON读写的属性数
+        size_t GetEntryCount() const { return m_entries.size(); }
+
+    private:
+        template<typename... Ts>
+        bool BindCodec(Entry& entry)
+        {
+            return (TryBindCodec<Ts>(entry) || ...);
+        }
+
+        template<typename T>
+        bool TryBindCodec(Entry& entry)
+        {
+            if (!entry.meta->template IsType<T>())
+                return false;
+            entry.write = &WriteValue<T>;
+            entry.read = &ReadValue<T>;
+            return true;
+        }
+
+        template<typename T>
+        static void WriteValue(const Entry& entry, ObjectBase& obj, std::string& out)
+        {
+            const MetaType* meta = entry.meta;
+            const void* src = meta->isCustomAccessor ? meta->getter(&obj) : reinterpret_cast<const char*>(&obj) + meta->fieldOffset;
+            PropertyJsonCodec<T>::Write(*static_cast<const T*>(src), out);
+        }
+
+        template<typename T>
+        static bool ReadValue(const Entry& entry, ObjectBase& obj, const PropertyJsonValue& value)
+        {
+            const MetaType* meta = entry.meta;
+            if (!meta->isCustomAccessor)
+            {
+                return PropertyJsonCodec<T>::Read(*reinterpret_cast<T*>(reinterpret_cast<char*>(&obj) + meta->fieldOffset), value);
+            }
+
+            T temp{};
+            if (!PropertyJsonCodec<T>::Read(temp, value))
+                return false;
+            meta->setter(&obj, &temp);
+            return true;
+        }
+
+        // 与OptionalProperty::GetOptionString一致：超出范围的选项值输出空字符串
+        static void WriteOption(const Entry& entry, ObjectBase& obj, std::string& out)
+        {
+            const MetaType* meta = entry.meta;
+            const void* src = meta->isCustomAccessor ? meta->getter(&obj) : reinterpret_cast<const char*>(&obj) + meta->fieldOffset;
+            const int index = meta->readOptionIndex(src);
+            if (index >= 0 && index < static_cast<int>(entry.options.size()))
+                PropertyJsonUtils::AppendString(out, std::string_view(entry.options[index]));
+            else
+                out.append("\"\"");
+        }
+
+        // 与OptionalProperty::SetOptionByString一致：按选项字符串查找索引后写入
+        static bool ReadOption(const Entry& entry, ObjectBase& obj, const PropertyJsonValue& value)
+        {
+            if (value.kind != PropertyJsonValue::Kind::String)
+                return false;
+            for (size_t i = 0; i < entry.options.size(); ++i)
+            {
+                if (std::string_view(entry.options[i]) != value.text)
+                    continue;
+
+                const int index = static_cast<int>(i);
+                const MetaType* meta = entry.meta;
+                if (!meta->isCustomAccessor)
+                {
+                    meta->constructOptionValue(reinterpret_cast<char*>(&obj) + meta->fieldOffset, index);
+                }
+                else
+                {
+                    alignas(long long) unsigned char storage[sizeof(long long)];
+                    meta->constructOptionValue(storage, index);
+                    meta->setter(&obj, storage);
+                }
+                return true;
+            }
+            return false;
+        }
+
+        // 合并选项列表（与OptionalProperty相同：属性所属类的选项在前，再沿父类链追加同名属性的选项并去重）
+        static std::vector<StringType> BuildOptionList(const PropertyDataType& classData, const MetaType& meta)
+        {
+            std::vector<StringType> options;
+            if (const PropertyDataType* ownerData = classData.FindClassData(meta.className))
+            {
+                auto it = ownerData->optionalPropertyMap.find(meta.name);
+                if (it != ownerData->optionalPropertyMap.end())
+                    options = it->second;
+            }
+
+            for (const PropertyDataType* parentData = classData.parentData; parentData; parentData = parentData->parentData)
+            {
+                auto it = parentData->optionalPropertyMap.find(meta.name);
+                if (it == parentData->optionalPropertyMap.end())
+                    continue;
+                for (const auto& option : it->second)
+                {
+                    if (std::find(options.begin(), options.end(), option) == options.end())
+                        options.push_back(option);
+                }
+            }
+            return options;
+        }
+
+        const PropertyDataType* m_classData;
+        std::vector<Entry> m_entries;
+        std::vector<const Entry*> m_entryById;
+    };
+
+    // 把JSON对象的键值分发到对象属性的SAX处理器
+    // 未知的键（及其嵌套的对象、数组）被忽略；已知属性遇到类型不符的值时中止解析
+    template<typename ObjectBase>
+    class PropertyJsonObjectHandler
+    {
+    public:
+        using Plan = PropertyJsonPlan<ObjectBase>;
+
+        PropertyJsonObjectHandler(const Plan& plan, ObjectBase& obj)
+            : m_plan(plan), m_obj(obj)
+        {
+        }
+
+        bool StartObject() { return Enter(); }
+        bool EndObject() { --m_depth; return true; }
+        bool StartArray() { return m_depth > 0 && Enter(); }
+        bool EndArray() { --m_depth; return true; }
+
+        bool Key(std::string_view key)
+        {
+            if (m_depth == 1)
+                m_current = m_plan.FindEntry(key);
+            return true;
+        }
+
+        bool Value(const PropertyJsonValue& value)
+        {
+            // 顶层必须是对象
+            if (m_depth == 0)
+                return false;
+            if (m_depth != 1 || !m_current)
+                return true;
+            // null表示保留当前值
+            if (value.kind == PropertyJsonValue::Kind::Null)
+                return true;
+            if (!m_current->read(*m_current, m_obj, value))
+            {
+                m_typeError = true;
+                return false;
+            }
+            return true;
+        }
+
+        // 是否因为值与属性类型不符而中止
+        bool HasTypeError() const { return m_typeError; }
+
+    private:
+        // 进入嵌套的对象或数组：已知属性的值只能是标量
+        bool Enter()
+        {
+            if (m_depth == 1 && m_current)
+            {
+                m_typeError = true;
+                return false;
+            }
+            ++m_depth;
+            return true;
+        }
+
+        const Plan& m_plan;
+        ObjectBase& m_obj;
+        const typename Plan::Entry* m_current = nullptr;
+        size_t m_depth = 0;
+        bool m_typeError = false;
+    };
+
+    // 把对象的属性写为一个JSON对象，追加到out末尾
+    template<typename ObjectType>
+    void ToJson(const ObjectType& obj, std::string& out)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        ObjectBase& base = const_cast<ObjectType&>(obj);
+        PropertyJsonPlan<ObjectBase>::Get(base.GetPropertyData()).Write(base, out);
+    }
+
+    // 从JSON对象读取属性：按键名称查找属性并直接写入，未知的键被忽略，值为null的属性保持不变
+    // JSON语法错误或值与属性类型不符时报告错误并抛出异常（对象可能已被部分修改）
+    template<typename ObjectType>
+    void FromJson(std::string_view json, ObjectType& obj)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        ObjectBase& base = obj;
+        PropertyJsonObjectHandler<ObjectBase> handler(PropertyJsonPlan<ObjectBase>::Get(base.GetPropertyData()), base);
+        PropertyJsonSaxParser parser;
+        if (parser.Parse(json, handler))
+            return;
+
+        if (handler.HasTypeError())
+        {
+            ObjectBase::ReportError(PropertyErrorKind::TypeMismatch, "JSON value does not match property type");
+            throw std::runtime_error("JSON value does not match property type");
+        }
+        ObjectBase::ReportError(PropertyErrorKind::Other, "Invalid JSON syntax");
+        throw std::runtime_error("Invalid JSON syntax");
+    }
+}
@@ -0,0 +1,353 @@
+#pragma once
+#include <ROP/RunTimeObjectProperty.h>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <algorithm>
+
+// ==================== 对象集合的并行遍历 ====================
+// 属性元数据在FINALIZE_PROPERTY_SYSTEM后只读，因此对互不相同的对象做反射读写可以安全并行。
+// 这里提供一个工作窃取线程池，以及在其上把对象集合分块并行处理的ParallelForEach/ParallelApply
+
+namespace ROP
+{
+    // 工作窃取线程池：每个工作线程有自己的任务队列，从自己队列的尾部取任务，空闲时从其他队列的头部窃取
+    // ParallelFor的调用线程在等待期间也会执行任务，因此在任务内部嵌套调用ParallelFor不会死锁
+    class PropertyThreadPool
+    {
+    public:
+        // threadCount为工作线程数（不含调用线程），0表示使用硬件线程数减一
+        explicit PropertyThreadPool(size_t threadCount = 0)
+        {
+            if (threadCount == 0)
+            {
+                const size_t hardwareThreads = std::thread::hardware_concurrency();
+                threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+            }
+
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                m_queues.push_back(std::make_unique<WorkQueue>());
+            }
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                m_threads.emplace_back([this, i]() { WorkerLoop(i); });
+            }
+        }
+
+        ~PropertyThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_wakeMutex);
+                m_stop = true;
+            }
+            m_wakeCondition.notify_all();
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        PropertyThreadPool(const PropertyThreadPool&) = delete;
+        PropertyThreadPool& operator=(const PropertyThreadPool&) = delete;
+
+        // 工作线程数
+        size_t GetThreadCount() const
+        {
+            return m_threads.size();
+        }
+
+        // 把[0, count)按grainSize分块并行执行fn(begin, end)，所有分块完成后返回
+        // 任一分块抛出的异常会在所有分块结束后在调用线程中重新抛出（只保留第一个）
+        template<typename Func>
+        void ParallelFor(size_t count, size_t grainSize, Func&& fn)
+        {
+            if (count == 0)
+                return;
+            grainSize = std::max<size_t>(grainSize, 1);
+            if (count <= grainSize)
+            {
+                fn(size_t(0), count);
+                return;
+            }
+
+            // 完成状态由所有分块任务共享持有：最后一个任务在锁内递减并通知，
+            // 调用线程也只在锁内观察到完成，因此返回后不会有任务再访问这些状态
+            const size_t chunkCount = (count + grainSize - 1) / grainSize;
+            auto state = std::make_shared<ParallelForState>();
+            state->remaining = chunkCount;
+
+            size_t submitted = 0;
+            std::exception_ptr submitError;
+            try
+            {
+                for (; submitted < chunkCount; ++submitted)
+                {
+                    const size_t begin = submitted * grainSize;
+                    const size_t end = std::min(begin + grainSize, count);
+                    Submit(submitted % m_queues.size(), [&fn, state, begin, end]()
+                        {
+                            std::exception_ptr taskError;
+                            try
+                            {
+                                fn(begin, end);
+                            }
+                            catch (...)
+                            {
+                                taskError = std::current_exception();
+                            }
+
+                            std::lock_guard<std::mutex> lock(state->mutex);
+                            if (taskError && !state->error)
+                                state->error = taskError;
+                            if (--state->remaining == 0)
+                                state->doneCondition.notify_all();
+                        });
+                }
+            }
+            catch (...)
+            {
+                // 提交中途失败：未提交的分块不再等待，但已提交的分块仍引用fn，必须等它们执行完再抛出
+                submitError = std::current_exception();
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->remaining -= chunkCount - submitted;
+            }
+
+            // 调用线程也参与执行；队列全部为空时剩余分块都已在其他线程上执行，等待它们完成
+            for (;;)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (state->remaining == 0)
+                        break;
+                }
+                if (!TryRunTask(CurrentQueueIndex()))
+                {
+                    std::unique_lock<std::mutex> lock(state->mutex);
+                    state->doneCondition.wait(lock, [&state]() { return state->remaining == 0; });
+                    break;
+                }
+            }
+
+            if (submitError)
+            {
+                std::rethrow_exception(submitError);
+            }
+            if (state->error)
+            {
+                std::rethrow_exception(state->error);
+            }
+        }
+
+        // 默认线程池（首次使用时创建）
+        // 默认线程池不随静态析构销毁：在静态析构或动态库卸载期间join工作线程会挂起（Windows加载器锁）。
+        // 需要回收线程时（例如卸载动态库或退出进程前）显式调用ShutdownDefault，此时不能有正在进行的并行调用
+        static PropertyThreadPool& Default()
+        {
+            std::lock_guard<std::mutex> lock(DefaultMutex());
+            PropertyThreadPool*& pool = DefaultInstance();
+            if (!pool)
+            {
+                pool = new PropertyThreadPool();
+            }
+            return *pool;
+        }
+
+        // 停止并回收默认线程池的工作线程；之后再次调用Default会重新创建
+        static void ShutdownDefault()
+        {
+            PropertyThreadPool* pool = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(DefaultMutex());
+                std::swap(pool, DefaultInstance());
+            }
+            delete pool;
+        }
+
+    private:
+        using Task = std::function<void()>;
+
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        // ParallelFor的完成状态
+        struct ParallelForState
+        {
+            std::mutex mutex;
+            std::condition_variable doneCondition;
+            size_t remaining = 0;
+            std::exception_ptr error;
+        };
+
+        // 入队与计数在同一把唤醒锁内完成：取出任务的一方必须先拿到唤醒锁才能递减计数，因此计数不会先减后加
+        // 入队抛出异常时计数保持不变
+        void Submit(size_t queueIndex, Task task)
+        {
+            {
+                std::lock_guard<std::mutex> wakeLock(m_wakeMutex);
+                {
+                    std::lock_guard<std::mutex> lock(m_queues[queueIndex]->mutex);
+                    m_queues[queueIndex]->tasks.push_back(std::move(task));
+                }
+                ++m_pendingTasks;
+            }
+            m_wakeCondition.notify_one();
+        }
+
+        // 先从首选队列尾部取任务，再依次从其他队列头部窃取；执行了一个任务时返回true
+        bool TryRunTask(size_t preferredQueue)
+        {
+            Task task;
+            const size_t queueCount = m_queues.size();
+            for (size_t i = 0; i < queueCount && !task; ++i)
+            {
+                WorkQueue& queue = *m_queues[(preferredQueue + i) % queueCount];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    continue;
+                if (i == 0)
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+            }
+            if (!task)
+                return false;
+
+            {
+                std::lock_guard<std::mutex> lock(m_wakeMutex);
+                --m_pendingTasks;
+            }
+            task();
+            return true;
+        }
+
+        void WorkerLoop(size_t index)
+        {
+            CurrentQueueIndex() = index;
+            for (;;)
+            {
+                if (TryRunTask(index))
+                    continue;
+
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_wakeCondition.wait(lock, [this]() { return m_stop || m_pendingTasks > 0; });
+                if (m_stop)
+                    return;
+            }
+        }
+
+        // 当前线程的首选队列（非工作线程为0）
+        static size_t& CurrentQueueIndex()
+        {
+            static thread_local size_t s_queueIndex = 0;
+            return s_queueIndex;
+        }
+
+        static std::mutex& DefaultMutex()
+        {
+            static std::mutex s_mutex;
+            return s_mutex;
+        }
+
+        static PropertyThreadPool*& DefaultInstance()
+        {
+            static PropertyThreadPool* s_pool = nullptr;
+            return s_pool;
+        }
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues;
+        std::vector<std::thread> m_threads;
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wakeCondition;
+        size_t m_pendingTasks = 0;
+        bool m_stop = false;
+    };
+
+    // 每个分块的默认对象数量
+    constexpr size_t PropertyParallelGrainSize = 1024;
+
+    // 并行对objects中的每个对象调用fn(ObjectType&)
+    // fn只能修改传入的对象（以及自己同步过的共享状态）；同一对象不会被两个线程同时处理
+    template<typename ObjectType, typename Func>
+    void ParallelForEach(PropertySpan<ObjectType* const> objects, Func&& fn,
+        PropertyThreadPool& pool = PropertyThreadPool::Default(), size_t grainSize = PropertyParallelGrainSize)
+    {
+        pool.ParallelFor(objects.size(), grainSize, [&objects, &fn](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    fn(*objects[i]);
+                }
+            });
+    }
+
+    template<typename ObjectType, typename Func>
+    void ParallelForEach(const std::vector<ObjectType*>& objects, Func&& fn,
+        PropertyThreadPool& pool = PropertyThreadPool::Default(), size_t grainSize = PropertyParallelGrainSize)
+    {
+        ParallelForEach(PropertySpan<ObjectType* const>(objects.data(), objects.size()), std::forward<Func>(fn), pool, grainSize);
+    }
+
+    // 并行对每个对象的同一属性调用fn(T& value)：所有对象必须是访问器所属类或其子类的实例
+    // 成员变量属性直接把字段引用传给fn；自定义访问器属性先通过getter读出副本，fn修改后再通过setter写回
+    template<typename T, typename ObjectType, typename Func>
+    void ParallelApply(PropertySpan<ObjectType* const> objects, const typename ObjectType::ROPPropertyAccessor& accessor, Func&& fn,
+        PropertyThreadPool& pool = PropertyThreadPool::Default(), size_t grainSize = PropertyParallelGrainSize)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+
+        const typename ObjectBase::ROPPropertyMeta* meta = accessor.GetMeta();
+        if (!meta)
+        {
+            ObjectBase::ReportError(PropertyErrorKind::InvalidProperty, "Invalid property accessor");
+            throw std::runtime_error("Invalid property accessor");
+        }
+        if (PropertyTypeCheckEnabled && !meta->template IsType<T>())
+        {
+            ObjectBase::ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: parallel apply");
+            throw std::runtime_error("Property type mismatch: parallel apply");
+        }
+
+        pool.ParallelFor(objects.size(), grainSize, [&objects, &fn, meta](size_t begin, size_t end)
+            {
+                if (!meta->isCustomAccessor)
+                {
+                    const ptrdiff_t fieldOffset = meta->fieldOffset;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        ObjectBase* obj = objects[i];
+                        fn(*reinterpret_cast<T*>(reinterpret_cast<char*>(obj) + fieldOffset));
+                    }
+                    return;
+                }
+
+                for (size_t i = begin; i < end; ++i)
+                {
+                    T value = *static_cast<const T*>(meta->getter(objects[i]));
+                    fn(value);
+                    meta->setter(objects[i], &value);
+                }
+            });
+    }
+
+    template<typename T, typename ObjectType, typename Func>
+    void ParallelApply(const std::vector<ObjectType*>& objects, const typename ObjectType::ROPPropertyAccessor& accessor, Func&& fn,
+        PropertyThreadPool& pool = PropertyThreadPool::Default(), size_t grainSize = PropertyParallelGrainSize)
+    {
+        ParallelApply<T>(PropertySpan<ObjectType* const>(objects.data(), objects.size()), accessor, std::forward<Func>(fn), pool, grainSize);
+    }
+}
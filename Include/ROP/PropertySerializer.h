@@ -0,0 +1,438 @@
+#pragma once
+#include <ROP/RunTimeObjectProperty.h>
+#include <limits>
+
+// ==================== 反射驱动的二进制序列化 ====================
+// 每个类在第一次序列化时遍历allPropertiesList构建一次序列化计划：可按字节复制的成员变量属性按字段偏移排序，
+// 地址相邻的合并为一次memcpy；其余属性（字符串、数组、自定义访问器）按列表顺序逐个编码。之后的读写不再做名称查找。
+// 该格式是与对象内存布局相关的原始格式（本机字节序、不带属性标识），只能由同一构建的程序读回。
+// 需要跨版本读取的数据使用SerializeTagged/DeserializeTagged（带字段标识的格式，见文件后半部分）
+
+namespace ROP
+{
+    // 把解码出的临时值交给自定义访问器属性的setter（作为readBinaryInto的sink）
+    template<typename ObjectBase>
+    struct PropertySetterSink
+    {
+        const typename ObjectBase::ROPPropertyMeta* meta;
+        ObjectBase* obj;
+
+        static void Invoke(void* context, void* value)
+        {
+            PropertySetterSink* sink = static_cast<PropertySetterSink*>(context);
+            sink->meta->setter(sink->obj, value);
+        }
+    };
+
+    // 单个类的二进制序列化计划（ObjectBase为PropertyObject的具体实例化类型，即各类中的ROPObjectType）
+    template<typename ObjectBase>
+    class PropertyBinaryPlan
+    {
+    public:
+        using MetaType = typename ObjectBase::ROPPropertyMeta;
+        using PropertyDataType = typename ObjectBase::ROPPropertyDataType;
+
+        // 一段地址连续、可按字节复制的字段
+        struct CopyRun
+        {
+            ptrdiff_t fieldOffset;
+            size_t size;
+        };
+
+        // 获取指定类的序列化计划（首次使用时构建，之后只读；类中有不支持二进制编码的属性时报告错误并抛出异常）
+        static const PropertyBinaryPlan& Get(const PropertyDataType& classData)
+        {
+            return classData.planStorage.template GetOrCreate<PropertyBinaryPlan>(classData);
+        }
+
+        explicit PropertyBinaryPlan(const PropertyDataType& classData)
+        {
+            std::vector<const MetaType*> bitwiseFields;
+            for (const auto* meta : classData.allPropertiesList.Pointers())
+            {
+                if (!meta->writeBinary || !meta->readBinary || (meta->isCustomAccessor && !meta->readBinaryInto))
+                {
+                    ObjectBase::ReportError(PropertyErrorKind::InvalidMeta, "Property type is not binary serializable");
+                    throw std::runtime_error("Property type is not binary serializable");
+                }
+
+                if (meta->isBitwiseSerializable && !meta->isCustomAccessor)
+                    bitwiseFields.push_back(meta);
+                else
+                    m_valueSteps.push_back(meta);
+            }
+
+            // 按字段偏移排序后合并首尾相接的字段（字段间有填充时不合并，避免写出未初始化的填充字节）
+            std::sort(bitwiseFields.begin(), bitwiseFields.end(),
+                [](const MetaType* a, const MetaType* b) { return a->fieldOffset < b->fieldOffset; });
+            for (const auto* meta : bitwiseFields)
+            {
+                if (!m_copyRuns.empty() && m_copyRuns.back().fieldOffset + static_cast<ptrdiff_t>(m_copyRuns.back().size) == meta->fieldOffset)
+                {
+                    m_copyRuns.back().size += meta->valueSize;
+                }
+                else
+                {
+                    m_copyRuns.push_back({ meta->fieldOffset, meta->valueSize });
+                }
+                m_fixedSize += meta->valueSize;
+            }
+        }
+
+        // 把对象追加编码到buffer末尾
+        void Write(const ObjectBase& obj, PropertyBinaryBuffer& buffer) const
+        {
+            const char* base = reinterpret_cast<const char*>(&obj);
+            const size_t start = buffer.size();
+            buffer.resize(start + m_fixedSize);
+            uint8_t* out = buffer.data() + start;
+            for (const CopyRun& run : m_copyRuns)
+            {
+                std::memcpy(out, base + run.fieldOffset, run.size);
+                out += run.size;
+            }
+
+            ObjectBase* self = const_cast<ObjectBase*>(&obj);
+            for (const MetaType* meta : m_valueSteps)
+            {
+                const void* src = meta->isCustomAccessor ? meta->getter(self) : base + meta->fieldOffset;
+                meta->writeBinary(src, buffer);
+            }
+        }
+
+        // 从[cursor, end)解码到对象，cursor前进到已读取数据之后；数据不完整时返回false（对象可能已被部分修改）
+        bool Read(const uint8_t*& cursor, const uint8_t* end, ObjectBase& obj) const
+        {
+            if (static_cast<size_t>(end - cursor) < m_fixedSize)
+                return false;
+
+            char* base = reinterpret_cast<char*>(&obj);
+            for (const CopyRun& run : m_copyRuns)
+            {
+                std::memcpy(base + run.fieldOffset, cursor, run.size);
+                cursor += run.size;
+            }
+
+            for (const MetaType* meta : m_valueSteps)
+            {
+                if (!meta->isCustomAccessor)
+                {
+                    if (!meta->readBinary(base + meta->fieldOffset, cursor, end))
+                        return false;
+                    continue;
+                }
+
+                PropertySetterSink<ObjectBase> sink{ meta, &obj };
+                if (!meta->readBinaryInto(cursor, end, &PropertySetterSink<ObjectBase>::Invoke, &sink))
+                    return false;
+            }
+            return true;
+        }
+
+        // 按字节复制部分的总大小
+        size_t GetFixedSize() const { return m_fixedSize; }
+        // 合并后的memcpy段数
+        size_t GetCopyRunCount() const { return m_copyRuns.size(); }
+        // 需要逐个编码的属性数
+        size_t GetValueStepCount() const { return m_valueSteps.size(); }
+
+    private:
+        std::vector<CopyRun> m_copyRuns;
+        std::vector<const MetaType*> m_valueSteps;
+        size_t m_fixedSize = 0;
+    };
+
+    // 把对象的所有属性（包括继承的）追加编码到buffer末尾
+    template<typename ObjectType>
+    void Serialize(const ObjectType& obj, PropertyBinaryBuffer& buffer)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        const ObjectBase& base = obj;
+        PropertyBinaryPlan<ObjectBase>::Get(base.GetPropertyData()).Write(base, buffer);
+    }
+
+    // 从buffer开头解码一个对象，返回读取的字节数；对象必须与序列化时属于同一类
+    // 数据不完整时报告错误并抛出异常
+    template<typename ObjectType>
+    size_t Deserialize(PropertySpan<const uint8_t> buffer, ObjectType& obj)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        ObjectBase& base = obj;
+        const uint8_t* cursor = buffer.data();
+        if (!PropertyBinaryPlan<ObjectBase>::Get(base.GetPropertyData()).Read(cursor, buffer.data() + buffer.size(), base))
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Binary data is truncated or corrupted");
+            throw std::runtime_error("Binary data is truncated or corrupted");
+        }
+        return static_cast<size_t>(cursor - buffer.data());
+    }
+
+    template<typename ObjectType>
+    size_t Deserialize(const PropertyBinaryBuffer& buffer, ObjectType& obj)
+    {
+        return Deserialize(PropertySpan<const uint8_t>(buffer.data(), buffer.size()), obj);
+    }
+
+    // ==================== 带字段标识的二进制格式 ====================
+    // 对象记录：格式版本(uint32) + 记录体长度(uint32) + 若干字段；字段：字段ID(uint32) + 值长度(uint32) + 值编码
+    // 字段ID由属性所属类的类名和属性名计算，与注册顺序、对象布局无关。读取时按字段ID在数组哈希表中查找属性，
+    // 未知字段按长度直接跳过，数据中没有的属性保持原值。因此类增加或删除属性后旧数据仍可读取，旧程序也能读取新数据
+    // 长度和值按本机字节序编码
+
+    // 当前的带标识格式版本
+    constexpr uint32_t PropertyTaggedFormatVersion = 1;
+
+    // 计算属性的字段ID（类名和属性名的FNV-1a哈希，两部分之间以0字节分隔）
+    inline uint32_t GetPropertyFieldId(std::string_view className, std::string_view propertyName)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : className)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        hash *= 16777619u;
+        for (char c : propertyName)
+        {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    // 单个类的带标识序列化计划
+    template<typename ObjectBase>
+    class PropertyTaggedPlan
+    {
+    public:
+        using MetaType = typename ObjectBase::ROPPropertyMeta;
+        using PropertyDataType = typename ObjectBase::ROPPropertyDataType;
+
+        static_assert(std::is_convertible_v<const typename ObjectBase::ROPKeyType&, std::string_view> &&
+            std::is_convertible_v<const typename ObjectBase::ROPStringType&, std::string_view>,
+            "Tagged binary format requires class and property names convertible to std::string_view");
+
+        struct Field
+        {
+            uint32_t fieldId;
+            const MetaType* meta;
+        };
+
+        // 获取指定类的计划（首次使用时构建，之后只读；类中有不支持二进制编码的属性或字段ID冲突时报告错误并抛出异常）
+        static const PropertyTaggedPlan& Get(const PropertyDataType& classData)
+        {
+            return classData.planStorage.template GetOrCreate<PropertyTaggedPlan>(classData);
+        }
+
+        explicit PropertyTaggedPlan(const PropertyDataType& classData)
+        {
+            m_fields.reserve(classData.allPropertiesList.size());
+            for (const auto* meta : classData.allPropertiesList.Pointers())
+            {
+                if (!meta->writeBinary || !meta->readBinary || (meta->isCustomAccessor && !meta->readBinaryInto))
+                {
+                    ObjectBase::ReportError(PropertyErrorKind::InvalidMeta, "Property type is not binary serializable");
+                    throw std::runtime_error("Property type is not binary serializable");
+                }
+                m_fields.push_back({ GetPropertyFieldId(std::string_view(meta->className), std::string_view(meta->name)), meta });
+            }
+
+            // 开放寻址表：容量为不小于字段数两倍的2的幂，槽位保存字段下标+1（0表示空槽）
+            size_t capacity = 1;
+            while (capacity < m_fields.size() * 2)
+                capacity <<= 1;
+            m_mask = capacity - 1;
+            m_slots.assign(capacity, 0);
+
+            for (size_t i = 0; i < m_fields.size(); ++i)
+            {
+                size_t slot = m_fields[i].fieldId & m_mask;
+                while (m_slots[slot] != 0)
+                {
+                    if (m_fields[m_slots[slot] - 1].fieldId == m_fields[i].fieldId)
+                    {
+                        ObjectBase::ReportError(PropertyErrorKind::InvalidMeta, "Duplicate property field id in tagged binary format");
+                        throw std::runtime_error("Duplicate property field id in tagged binary format");
+                    }
+                    slot = (slot + 1) & m_mask;
+                }
+                m_slots[slot] = static_cast<uint32_t>(i + 1);
+            }
+        }
+
+        // 按字段ID查找字段，类中没有该字段时返回nullptr
+        const Field* FindField(uint32_t fieldId) const
+        {
+            for (size_t slot = fieldId & m_mask; m_slots[slot] != 0; slot = (slot + 1) & m_mask)
+            {
+                const Field& field = m_fields[m_slots[slot] - 1];
+                if (field.fieldId == fieldId)
+                    return &field;
+            }
+            return nullptr;
+        }
+
+        // 把对象追加编码为一条记录
+        void Write(const ObjectBase& obj, PropertyBinaryBuffer& buffer) const
+        {
+            const size_t recordStart = buffer.size();
+            const uint32_t header[2] = { PropertyTaggedFormatVersion, 0 };
+            PropertyBinaryIO::WriteBytes(buffer, header, sizeof(header));
+
+            ObjectBase* self = const_cast<ObjectBase*>(&obj);
+            for (const Field& field : m_fields)
+            {
+                const MetaType* meta = field.meta;
+                const size_t fieldStart = buffer.size();
+
+                // 按字节编码的成员变量长度固定，字段头和值一次写入
+                if (meta->isBitwiseSerializable && !meta->isCustomAccessor)
+                {
+                    const uint32_t fieldHeader[2] = { field.fieldId, static_cast<uint32_t>(meta->valueSize) };
+                    buffer.resize(fieldStart + sizeof(fieldHeader) + meta->valueSize);
+                    std::memcpy(buffer.data() + fieldStart, fieldHeader, sizeof(fieldHeader));
+                    std::memcpy(buffer.data() + fieldStart + sizeof(fieldHeader), reinterpret_cast<const char*>(&obj) + meta->fieldOffset, meta->valueSize);
+                    continue;
+                }
+
+                const uint32_t fieldHeader[2] = { field.fieldId, 0 };
+                PropertyBinaryIO::WriteBytes(buffer, fieldHeader, sizeof(fieldHeader));
+
+                const void* src = meta->isCustomAccessor ? meta->getter(self) : reinterpret_cast<const char*>(&obj) + meta->fieldOffset;
+                meta->writeBinary(src, buffer);
+                PatchLength(buffer, fieldStart + sizeof(uint32_t), buffer.size() - fieldStart - sizeof(fieldHeader));
+            }
+            PatchLength(buffer, recordStart + sizeof(uint32_t), buffer.size() - recordStart - sizeof(header));
+        }
+
+        // 解码记录体[cursor, end)中的所有字段；字段头损坏或长度越界时返回false（对象可能已被部分修改）
+        // 单个字段的值与属性类型不符（例如int字段被改为int64_t）时报告错误并按长度跳过该字段，其余字段照常读取
+        bool Read(const uint8_t* cursor, const uint8_t* end, ObjectBase& obj) const
+        {
+            while (cursor != end)
+            {
+                uint32_t fieldHeader[2];
+                if (!PropertyBinaryIO::ReadBytes(cursor, end, fieldHeader, sizeof(fieldHeader)) ||
+                    fieldHeader[1] > static_cast<size_t>(end - cursor))
+                    return false;
+
+                const uint8_t* valueEnd = cursor + fieldHeader[1];
+                const Field* field = FindField(fieldHeader[0]);
+                if (field && !ReadField(field->meta, cursor, valueEnd, obj))
+                {
+                    ObjectBase::ReportError(PropertyErrorKind::TypeMismatch, "Tagged binary field does not match property type: field skipped");
+                }
+                cursor = valueEnd;
+            }
+            return true;
+        }
+
+        // 把一个字段的值[value, valueEnd)解码到对象的属性；值的编码必须恰好占满整个长度，否则不修改属性并返回false
+        static bool ReadField(const MetaType* meta, const uint8_t* value, const uint8_t* valueEnd, ObjectBase& obj)
+        {
+            // 按字节编码的成员变量：长度等于值的大小时直接复制
+            if (meta->isBitwiseSerializable && !meta->isCustomAccessor)
+            {
+                if (static_cast<size_t>(valueEnd - value) != meta->valueSize)
+                    return false;
+                std::memcpy(reinterpret_cast<char*>(&obj) + meta->fieldOffset, value, meta->valueSize);
+                return true;
+            }
+
+            // 无法解码到临时对象的成员变量（类型不可默认构造）只能原地解码
+            if (!meta->readBinaryInto)
+            {
+                return meta->readBinary(reinterpret_cast<char*>(&obj) + meta->fieldOffset, value, valueEnd) && value == valueEnd;
+            }
+
+            // 其余属性先解码到临时对象，sink确认编码恰好占满整个长度后才写入
+            TaggedFieldSink sink{ meta, &obj, &value, valueEnd, false };
+            meta->readBinaryInto(value, valueEnd, &TaggedFieldSink::Invoke, &sink);
+            return sink.applied;
+        }
+
+        // 字段数
+        size_t GetFieldCount() const { return m_fields.size(); }
+
+    private:
+        // 解码出的临时值只有在游标恰好到达值末尾时才写入属性（成员变量移动赋值，自定义访问器调用setter）
+        struct TaggedFieldSink
+        {
+            const MetaType* meta;
+            ObjectBase* obj;
+            const uint8_t* const* cursor;
+            const uint8_t* valueEnd;
+            bool applied;
+
+            static void Invoke(void* context, void* value)
+            {
+                TaggedFieldSink* sink = static_cast<TaggedFieldSink*>(context);
+                if (*sink->cursor != sink->valueEnd)
+                    return;
+                if (!sink->meta->isCustomAccessor)
+                    sink->meta->moveAssign(reinterpret_cast<char*>(sink->obj) + sink->meta->fieldOffset, value);
+                else
+                    sink->meta->setter(sink->obj, value);
+                sink->applied = true;
+            }
+        };
+
+        static void PatchLength(PropertyBinaryBuffer& buffer, size_t position, size_t length)
+        {
+            if (length > std::numeric_limits<uint32_t>::max())
+            {
+                ObjectBase::ReportError(PropertyErrorKind::Other, "Property value is too large for tagged binary format");
+                throw std::runtime_error("Property value is too large for tagged binary format");
+            }
+            const uint32_t value = static_cast<uint32_t>(length);
+            std::memcpy(buffer.data() + position, &value, sizeof(value));
+        }
+
+        std::vector<Field> m_fields;
+        std::vector<uint32_t> m_slots;
+        size_t m_mask = 0;
+    };
+
+    // 把对象的所有属性（包括继承的）编码为一条带字段标识的记录，追加到buffer末尾
+    template<typename ObjectType>
+    void SerializeTagged(const ObjectType& obj, PropertyBinaryBuffer& buffer)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        const ObjectBase& base = obj;
+        PropertyTaggedPlan<ObjectBase>::Get(base.GetPropertyData()).Write(base, buffer);
+    }
+
+    // 从buffer开头读取一条带字段标识的记录，返回读取的字节数（包括记录中被跳过的未知字段和与类型不符的字段）
+    // 格式版本不受支持、数据不完整或记录结构损坏时报告错误并抛出异常
+    template<typename ObjectType>
+    size_t DeserializeTagged(PropertySpan<const uint8_t> buffer, ObjectType& obj)
+    {
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        ObjectBase& base = obj;
+
+        const uint8_t* cursor = buffer.data();
+        const uint8_t* end = buffer.data() + buffer.size();
+        uint32_t header[2];
+        if (!PropertyBinaryIO::ReadBytes(cursor, end, header, sizeof(header)) || header[1] > static_cast<size_t>(end - cursor))
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Tagged binary data is truncated");
+            throw std::runtime_error("Tagged binary data is truncated");
+        }
+        if (header[0] == 0 || header[0] > PropertyTaggedFormatVersion)
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Unsupported tagged binary format version");
+            throw std::runtime_error("Unsupported tagged binary format version");
+        }
+
+        if (!PropertyTaggedPlan<ObjectBase>::Get(base.GetPropertyData()).Read(cursor, cursor + header[1], base))
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Tagged binary data is corrupted");
+            throw std::runtime_error("Tagged binary data is corrupted");
+        }
+        return sizeof(header) + header[1];
+    }
+
+    template<typename ObjectType>
+    size_t DeserializeTagged(const PropertyBinaryBuffer& buffer, ObjectType& obj)
+    {
+        return DeserializeTagged(PropertySpan<const uint8_t>(buffer.data(), buffer.size()), obj);
+    }
+}
@@ -0,0 +1,386 @@
+#pragma once
+#include <ROP/PropertySerializer.h>
+#include <fstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ==================== 内存映射的只读对象存储 ====================
+// PropertyMappedStore::Write把一组同类对象写入文件（每个对象一条带字段标识的记录，见SerializeTagged），
+// 打开时只映射文件并校验文件头，不解码任何对象。对象在第一次被访问时才创建（默认构造）并扫描一次字段头，
+// 每个属性在第一次通过GetProperty/GetPropertyById访问时才从映射的数据中解码，返回的是普通的Property。
+// 记录使用带字段标识的格式，因此类增加或删除属性后仍可打开旧文件
+
+namespace ROP
+{
+    // 只读文件映射（POSIX使用mmap，Windows使用MapViewOfFile）
+    class PropertyFileMapping
+    {
+    public:
+        PropertyFileMapping() = default;
+
+        ~PropertyFileMapping()
+        {
+            Close();
+        }
+
+        PropertyFileMapping(const PropertyFileMapping&) = delete;
+        PropertyFileMapping& operator=(const PropertyFileMapping&) = delete;
+
+        // 映射整个文件，失败时返回false
+        bool Open(const std::string& path)
+        {
+            Close();
+#ifdef _WIN32
+            m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (m_file == INVALID_HANDLE_VALUE)
+                return false;
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(m_file, &fileSize))
+            {
+                Close();
+                return false;
+            }
+            m_size = static_cast<size_t>(fileSize.QuadPart);
+            if (m_size == 0)
+                return true;
+            m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!m_mapping)
+            {
+                Close();
+                return false;
+            }
+            m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            if (!m_data)
+            {
+                Close();
+                return false;
+            }
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return false;
+            struct stat fileStat;
+            if (::fstat(fd, &fileStat) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+            m_size = static_cast<size_t>(fileStat.st_size);
+            if (m_size != 0)
+            {
+                void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (address == MAP_FAILED)
+                {
+                    ::close(fd);
+                    m_size = 0;
+                    return false;
+                }
+                m_data = static_cast<const uint8_t*>(address);
+            }
+            // 映射建立后文件描述符不再需要
+            ::close(fd);
+#endif
+            return true;
+        }
+
+        void Close()
+        {
+#ifdef _WIN32
+            if (m_data)
+                UnmapViewOfFile(m_data);
+            if (m_mapping)
+                CloseHandle(m_mapping);
+            if (m_file != INVALID_HANDLE_VALUE)
+                CloseHandle(m_file);
+            m_mapping = nullptr;
+            m_file = INVALID_HANDLE_VALUE;
+#else
+            if (m_data)
+                ::munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        const uint8_t* Data() const { return m_data; }
+        size_t Size() const { return m_size; }
+
+    private:
+#ifdef _WIN32
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+#endif
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    // 存储文件头（之后依次为类名、各对象的记录、按8字节对齐的记录偏移索引）
+    struct PropertyStoreHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t objectCount;
+        uint64_t indexOffset;          // 记录偏移索引（objectCount个uint64_t）在文件中的位置
+        uint32_t classNameLength;
+        uint32_t reserved;
+    };
+
+    constexpr uint32_t PropertyStoreMagic = 0x53504F52;    // "ROPS"
+    constexpr uint32_t PropertyStoreVersion = 1;
+
+    // 内存映射的只读对象存储：ObjectType为存储中对象的类型（需可默认构造）
+    // 懒解码会修改存储的内部状态，同一存储不能被多个线程同时访问
+    template<typename ObjectType>
+    class PropertyMappedStore
+    {
+    public:
+        using ObjectBase = typename ObjectType::ROPObjectType;
+        using PropertyType = typename ObjectType::ROPProperty;
+        using KeyType = typename ObjectType::ROPKeyType;
+        using PropertyDataType = typename ObjectType::ROPPropertyDataType;
+        using Plan = PropertyTaggedPlan<ObjectBase>;
+
+        // 把objects写入path（覆盖已有文件）；对象按ObjectType读回，子类对象多出的属性在读取时被跳过
+        static void Write(const std::string& path, PropertySpan<ObjectType* const> objects)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                ObjectBase::ReportError(PropertyErrorKind::Other, "Failed to create property store file");
+                throw std::runtime_error("Failed to create property store file");
+            }
+
+            ObjectType probe;
+            const auto className = probe.GetClassName();
+            const std::string_view classNameView(className);
+
+            PropertyStoreHeader header{};
+            header.magic = PropertyStoreMagic;
+            header.version = PropertyStoreVersion;
+            header.objectCount = objects.size();
+            header.classNameLength = static_cast<uint32_t>(classNameView.size());
+
+            // 记录先编码到缓冲区，达到一定大小后整块写入文件
+            PropertyBinaryBuffer buffer;
+            PropertyBinaryIO::WriteBytes(buffer, &header, sizeof(header));
+            PropertyBinaryIO::WriteBytes(buffer, classNameView.data(), classNameView.size());
+
+            const size_t flushSize = 1 << 20;
+            uint64_t flushedSize = 0;
+            std::vector<uint64_t> recordOffsets;
+            recordOffsets.reserve(objects.size());
+            for (ObjectType* obj : objects)
+            {
+                recordOffsets.push_back(flushedSize + buffer.size());
+                SerializeTagged(*obj, buffer);
+                if (buffer.size() >= flushSize)
+                {
+                    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+                    flushedSize += buffer.size();
+                    buffer.clear();
+                }
+            }
+
+            buffer.resize(buffer.size() + (8 - (flushedSize + buffer.size()) % 8) % 8, 0);
+            header.indexOffset = flushedSize + buffer.size();
+            PropertyBinaryIO::WriteBytes(buffer, recordOffsets.data(), recordOffsets.size() * sizeof(uint64_t));
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+            // 索引位置确定后回写文件头
+            file.seekp(0);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            if (!file)
+            {
+                ObjectBase::ReportError(PropertyErrorKind::Other, "Failed to write property store file");
+                throw std::runtime_error("Failed to write property store file");
+            }
+        }
+
+        static void Write(const std::string& path, const std::vector<ObjectType*>& objects)
+        {
+            Write(path, PropertySpan<ObjectType* const>(objects.data(), objects.size()));
+        }
+
+        // 映射存储文件并校验文件头（不解码任何对象）；文件无法打开、格式不符或类名不一致时报告错误并抛出异常
+        explicit PropertyMappedStore(const std::string& path)
+        {
+            if (!m_mapping.Open(path))
+            {
+                ObjectBase::ReportError(PropertyErrorKind::Other, "Failed to map property store file");
+                throw std::runtime_error("Failed to map property store file");
+            }
+
+            ObjectType probe;
+            const auto className = probe.GetClassName();
+            m_classData = &probe.GetPropertyData();
+            m_plan = &Plan::Get(*m_classData);
+
+            PropertyStoreHeader header{};
+            const uint8_t* data = m_mapping.Data();
+            const size_t size = m_mapping.Size();
+            if (size < sizeof(header))
+                ThrowInvalidStore();
+            std::memcpy(&header, data, sizeof(header));
+
+            if (header.magic != PropertyStoreMagic || header.version != PropertyStoreVersion ||
+                header.classNameLength > size - sizeof(header) ||
+                header.indexOffset > size || header.objectCount > (size - header.indexOffset) / sizeof(uint64_t))
+                ThrowInvalidStore();
+
+            if (std::string_view(reinterpret_cast<const char*>(data) + sizeof(header), header.classNameLength) != std::string_view(className))
+            {
+                ObjectBase::ReportError(PropertyErrorKind::TypeMismatch, "Property store class does not match object type");
+                throw std::runtime_error("Property store class does not match object type");
+            }
+
+            m_recordOffsets = data + header.indexOffset;
+            m_objects.resize(static_cast<size_t>(header.objectCount));
+        }
+
+        PropertyMappedStore(const PropertyMappedStore&) = delete;
+        PropertyMappedStore& operator=(const PropertyMappedStore&) = delete;
+
+        // 对象数量
+        size_t Size() const
+        {
+            return m_objects.size();
+        }
+
+        // 获取第index个对象的属性（该属性在第一次访问时解码），属性不存在时返回无效的Property对象
+        PropertyType GetProperty(size_t index, const KeyType& name)
+        {
+            return GetPropertyById(index, ObjectType::GetClassPropertyId(name));
+        }
+
+        // 通过属性ID获取第index个对象的属性（该属性在第一次访问时解码），ID越界时返回无效的Property对象
+        PropertyType GetPropertyById(size_t index, PropertyId id)
+        {
+            LazyObject& lazy = Touch(index);
+            if (id < lazy.pending.size())
+            {
+                DecodeProperty(lazy, id);
+            }
+            return lazy.object->GetPropertyById(id);
+        }
+
+        // 获取第index个对象（解码其所有尚未解码的属性）
+        ObjectType& GetObject(size_t index)
+        {
+            LazyObject& lazy = Touch(index);
+            for (PropertyId id = 0; id < lazy.pending.size(); ++id)
+            {
+                DecodeProperty(lazy, id);
+            }
+            return *lazy.object;
+        }
+
+        // 第index个对象是否已被访问过
+        bool IsObjectLoaded(size_t index) const
+        {
+            return index < m_objects.size() && m_objects[index] != nullptr;
+        }
+
+        // 已解码的属性总数
+        size_t GetDecodedPropertyCount() const
+        {
+            return m_decodedPropertyCount;
+        }
+
+    private:
+        // 尚未解码的属性值在映射中的位置
+        struct PendingValue
+        {
+            const uint8_t* data = nullptr;
+            uint32_t size = 0;
+        };
+
+        struct LazyObject
+        {
+            std::unique_ptr<ObjectType> object;
+            std::vector<PendingValue> pending;     // 按属性ID索引，data为nullptr表示已解码或记录中没有该属性
+        };
+
+        // 首次访问对象时创建对象并扫描记录的字段头，记录每个已知字段的值的位置
+        LazyObject& Touch(size_t index)
+        {
+            if (index >= m_objects.size())
+            {
+                ObjectBase::ReportError(PropertyErrorKind::Other, "Property store object index out of range");
+                throw std::runtime_error("Property store object index out of range");
+            }
+            if (m_objects[index])
+                return *m_objects[index];
+
+            uint64_t recordOffset = 0;
+            std::memcpy(&recordOffset, m_recordOffsets + index * sizeof(uint64_t), sizeof(recordOffset));
+
+            const uint8_t* end = m_mapping.Data() + m_mapping.Size();
+            if (recordOffset > m_mapping.Size())
+                ThrowInvalidStore();
+            const uint8_t* cursor = m_mapping.Data() + recordOffset;
+
+            uint32_t recordHeader[2];
+            if (!PropertyBinaryIO::ReadBytes(cursor, end, recordHeader, sizeof(recordHeader)) ||
+                recordHeader[0] == 0 || recordHeader[0] > PropertyTaggedFormatVersion ||
+                recordHeader[1] > static_cast<size_t>(end - cursor))
+                ThrowInvalidStore();
+
+            auto lazy = std::make_unique<LazyObject>();
+            lazy->pending.resize(m_classData->propertyIdTable.size());
+            const uint8_t* bodyEnd = cursor + recordHeader[1];
+            while (cursor != bodyEnd)
+            {
+                uint32_t fieldHeader[2];
+                if (!PropertyBinaryIO::ReadBytes(cursor, bodyEnd, fieldHeader, sizeof(fieldHeader)) ||
+                    fieldHeader[1] > static_cast<size_t>(bodyEnd - cursor))
+                    ThrowInvalidStore();
+
+                if (const typename Plan::Field* field = m_plan->FindField(fieldHeader[0]))
+                {
+                    lazy->pending[field->meta->propertyId] = { cursor, fieldHeader[1] };
+                }
+                cursor += fieldHeader[1];
+            }
+
+            lazy->object = std::make_unique<ObjectType>();
+            m_objects[index] = std::move(lazy);
+            return *m_objects[index];
+        }
+
+        void DecodeProperty(LazyObject& lazy, PropertyId id)
+        {
+            PendingValue& pending = lazy.pending[id];
+            if (!pending.data)
+                return;
+
+            ObjectBase& base = *lazy.object;
+            if (!Plan::ReadField(m_classData->propertyIdTable[id], pending.data, pending.data + pending.size, base))
+                ThrowInvalidStore();
+            pending.data = nullptr;
+            ++m_decodedPropertyCount;
+        }
+
+        [[noreturn]] static void ThrowInvalidStore()
+        {
+            ObjectBase::ReportError(PropertyErrorKind::Other, "Property store file is invalid or corrupted");
+            throw std::runtime_error("Property store file is invalid or corrupted");
+        }
+
+        PropertyFileMapping m_mapping;
+        const PropertyDataType* m_classData = nullptr;
+        const Plan* m_plan = nullptr;                  // 存放在类的PropertyData中，类所在的动态库卸载后不再有效
+        const uint8_t* m_recordOffsets = nullptr;
+        std::vector<std::unique_ptr<LazyObject>> m_objects;
+        size_t m_decodedPropertyCount = 0;
+    };
+}
@@ -2,14 +2,19 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <functional>
 #include <memory>
+#include <new>
 #include <typeinfo>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <stdexcept>
+#include <atomic>
 #include <algorithm>
 #include <map>
 #include <chrono>
@@ -30,552 +35,2134 @@ namespace ROP
         }
     };
 
-    // ǰ
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        class PropertyObject;
-
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        struct PropertyMeta;
+    // ࣺÿִжԭӼ
+    enum class PropertyErrorKind : uint8_t
+    {
+        InvalidProperty = 0,    // ЧԾ
+        InvalidMeta,            // ЧԪָ
+        TypeMismatch,           // עͲһ
+        NullReference,          // ȡʧ
+        NotOptional,            // Բѡ
+        DuplicateOption,        // עѡʱѡַظ
+        Other,                  // ͨReportError(const StringType&)
+        Count
+    };
 
-    // ģ࣬װԺö
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        class Property
+    // 󱨸ÿαۼӶӦԭӼֻʱŹϢôص
+    // ͬһ<StringType, ErrorCallback>ϵб㹲һصPropertyObject::SetErrorCallbackãһ
+    // ̶߳ȡصӦڳʼ׶
+    template<typename StringType, typename ErrorCallback>
+    class PropertyErrorReporter
     {
     public:
-        using ErrorCallbackType = ErrorCallback;
-
-        // ĬϹ캯 - Ч
-        Property() : m_type(EnumType{}), m_metaPtr(nullptr), m_objPtr(nullptr)
-        {
-        }
-
-        Property(const EnumType type, const void* metaPtr,
-            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* objPtr)
-            : m_type(type), m_metaPtr(metaPtr), m_objPtr(objPtr)
-        {
-        }
-
-        // жǷЧ
-        bool IsValid() const
-        {
-            return m_metaPtr != nullptr && m_objPtr != nullptr;
-        }
-
-        // ȡö
-        EnumType GetType() const
+        // ϢΪַʱŹStringType
+        static void Report(PropertyErrorKind kind, const char* message)
         {
-            if (!IsValid())
+            CountError(kind);
+            if (IsOutputEnabled())
             {
-                ErrorCallback()("Invalid property: cannot get type");
-                throw std::runtime_error("Invalid property: cannot get type");
+                Callback()(StringType(message));
             }
-            return m_type;
         }
 
-        // ȡֵָͣ
-        template<typename T>
-        T GetValue() const
+        // Ϣѹã
+        static void Report(PropertyErrorKind kind, const StringType& message)
         {
-            if (!IsValid())
-            {
-                ErrorCallback()("Invalid property: cannot get value");
-                throw std::runtime_error("Invalid property: cannot get value");
-            }
-            if (!m_objPtr)
+            CountError(kind);
+            if (IsOutputEnabled())
             {
-                ErrorCallback()("Invalid property object");
-                throw std::runtime_error("Invalid property object");
+                Callback()(message);
             }
-            return m_objPtr->template GetPropertyValue<T>(m_metaPtr);
         }
 
-        // ֵָͣ
-        template<typename T>
-        void SetValue(const T& value)
+        // ϢmakeMessageɣֻʱã
+        template<typename MessageFactory, typename = std::enable_if_t<std::is_invocable_r_v<StringType, MessageFactory&>>>
+        static void Report(PropertyErrorKind kind, MessageFactory&& makeMessage)
         {
-            if (!IsValid())
-            {
-                ErrorCallback()("Invalid property: cannot set value");
-                throw std::runtime_error("Invalid property: cannot set value");
-            }
-            if (!m_objPtr)
+            CountError(kind);
+            if (IsOutputEnabled())
             {
-                ErrorCallback()("Invalid property object");
-                throw std::runtime_error("Invalid property object");
+                Callback()(makeMessage());
             }
-            m_objPtr->template SetPropertyValue<T>(m_metaPtr, value);
         }
 
-        template<typename T>
-        T* GetPointer()
+        // ôصͬʱ
+        static void SetCallback(const ErrorCallback& callback)
         {
-            if (!IsValid())
-                return nullptr;
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
-            void* ptr = meta->getter(const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_objPtr));
-            return static_cast<T*>(ptr);
+            Callback() = callback;
+            OutputEnabled().store(true, std::memory_order_relaxed);
         }
 
-        // ȡֵ
-        template<typename T>
-        T& GetReference()
+        // ûرմرպֻϢҲûص
+        static void SetOutputEnabled(bool enabled)
         {
-            T* ptr = GetPointer<T>();
-            if (!ptr)
-            {
-                ErrorCallback()("Failed to get property reference");
-                throw std::runtime_error("Failed to get property reference");
-            }
-            return *ptr;
+            OutputEnabled().store(enabled, std::memory_order_relaxed);
         }
 
-        // ȡֵĳ
-        template<typename T>
-        const T& GetConstReference() const
+        static bool IsOutputEnabled()
         {
-            const T* ptr = GetConstPointer<T>();
-            if (!ptr)
-            {
-                ErrorCallback()("Failed to get property const reference");
-                throw std::runtime_error("Failed to get property const reference");
-            }
-            return *ptr;
+            return OutputEnabled().load(std::memory_order_relaxed);
         }
 
-        template<typename T>
-        const T* GetConstPointer() const
+        // ȡָĴ
+        static uint64_t GetErrorCount(PropertyErrorKind kind)
         {
-            if (!IsValid())
-                return nullptr;
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
-            void* ptr = meta->getter(const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_objPtr));
-            return static_cast<const T*>(ptr);
+            return Counters()[static_cast<size_t>(kind)].load(std::memory_order_relaxed);
         }
 
-        // ȡԪָ
-        const void* GetMetaPtr() const
+        // ȡĴܴ
+        static uint64_t GetTotalErrorCount()
         {
-            if (!IsValid())
+            uint64_t total = 0;
+            for (size_t i = 0; i < static_cast<size_t>(PropertyErrorKind::Count); ++i)
             {
-                ErrorCallback()("Invalid property: cannot get meta pointer");
-                throw std::runtime_error("Invalid property: cannot get meta pointer");
+                total += Counters()[i].load(std::memory_order_relaxed);
             }
-            return m_metaPtr;
+            return total;
         }
 
-        // ȡ
-        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetObject() const
+        // м
+        static void ResetErrorCounts()
         {
-            if (!IsValid())
+            for (size_t i = 0; i < static_cast<size_t>(PropertyErrorKind::Count); ++i)
             {
-                ErrorCallback()("Invalid property: cannot get object");
-                throw std::runtime_error("Invalid property: cannot get object");
+                Counters()[i].store(0, std::memory_order_relaxed);
             }
-            return m_objPtr;
         }
 
-        // ȡ
-        StringType GetDescription() const
+    private:
+        static void CountError(PropertyErrorKind kind)
         {
-            if (!IsValid())
-                return StringType{};
-
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
-            return meta ? meta->description : StringType{};
+            Counters()[static_cast<size_t>(kind)].fetch_add(1, std::memory_order_relaxed);
         }
 
-        // ȡƣKeyType
-        KeyType GetName() const
+        static ErrorCallback& Callback()
         {
-            if (!IsValid())
-                return KeyType{};
-
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
-            return meta ? meta->name : KeyType{};
+            static ErrorCallback s_callback = ErrorCallback();
+            return s_callback;
         }
 
-        // ȡַʹKeyToStringת
-        StringType GetNameString() const
+        static std::atomic<bool>& OutputEnabled()
         {
-            if (!IsValid())
-                return StringType{};
-
-            KeyType name = GetName();
-            return KeyToString()(name);
+            static std::atomic<bool> s_outputEnabled(true);
+            return s_outputEnabled;
         }
 
-        // ȡ
-        StringType GetClassName() const
+        static std::atomic<uint64_t>* Counters()
         {
-            if (!IsValid())
-                return StringType{};
-
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
-            return meta ? meta->className : StringType{};
+            static std::atomic<uint64_t> s_counters[static_cast<size_t>(PropertyErrorKind::Count)] = {};
+            return s_counters;
         }
-
-    private:
-        EnumType m_type;
-        const void* m_metaPtr;
-        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_objPtr;
     };
 
-    // Ԫ
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        struct PropertyMeta
+    // IDͣÿFINALIZE_PROPERTY_SYSTEMʱĳID
+    // ǰ棬˸нõIDбֲ
+    using PropertyId = uint32_t;
+    constexpr PropertyId InvalidPropertyId = static_cast<PropertyId>(-1);
+
+    // IDעʱPropertyMetaͻʱȽϴַȽ
+    // ȡtypeid(T).hash_code()㣬綯̬Ᵽһ£ÿֻһ
+    // ROP_DISABLE_TYPE_CHECKɹرGetValue/SetValueȷʱͼ飨TypedPropertyʱȻ飩
+    using PropertyTypeId = size_t;
+
+#ifdef ROP_DISABLE_TYPE_CHECK
+    constexpr bool PropertyTypeCheckEnabled = false;
+#else
+    constexpr bool PropertyTypeCheckEnabled = true;
+#endif
+
+    // ԷʲԣöػGetValue/SetValueȷǷЧԺ
+    // CheckedΪfalseʱProperty/PropertyAccessor/PropertyObjectķЧԼͼ飬
+    // Ҳ󡢲쳣÷뱣֤ЧȷTryϵнӿںͷָĽӿڲӰ죩
+    // ĬΪtrueROP_UNCHECKED_ACCESSʱĬΪfalse
+    // namespace ROP { template<> struct PropertyAccessPolicy<MyPropertyEnum> { static constexpr bool Checked = false; }; }
+    template<typename EnumType>
+    struct PropertyAccessPolicy
     {
-        KeyType name;
-        EnumType enumType;
-        StringType typeName;
-        size_t offset;
-        StringType className;
-        std::function<void* (PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*)> getter;
-        std::function<void(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*, void*)> setter;
-        bool isCustomAccessor;
-        size_t registrationOrder = 0;
+#ifdef ROP_UNCHECKED_ACCESS
+        static constexpr bool Checked = false;
+#else
+        static constexpr bool Checked = true;
+#endif
+    };
 
-        // ǷΪѡԱ־
-        bool isOptional = false;
+    template<typename T>
+    PropertyTypeId GetPropertyTypeId()
+    {
+        static const PropertyTypeId s_typeId = typeid(T).hash_code();
+        return s_typeId;
+    }
 
-        // 
-        StringType description;
+    // Է״̬룺TryϵнӿڣTryGetValue/TrySetValue/TryGetPropertyȣֵͨʧԭ
+    // TryϵнӿڲϢôص쳣ʺȱʧڳ̬·
+    enum class PropertyStatus : uint8_t
+    {
+        Ok = 0,
+        NotFound,           // ƻID
+        InvalidProperty,    // ԾЧ
+        TypeMismatch        // עͲһ
+    };
 
-        bool operator==(const PropertyMeta& other) const
+    // ȡ״̬ؾַ̬ڴ棩
+    inline const char* PropertyStatusToString(PropertyStatus status)
+    {
+        switch (status)
         {
-            KeyEqual equal;
-            return equal(name, other.name) && className == other.className && enumType == other.enumType;
+        case PropertyStatus::Ok: return "Ok";
+        case PropertyStatus::NotFound: return "Property not found";
+        case PropertyStatus::InvalidProperty: return "Invalid property";
+        case PropertyStatus::TypeMismatch: return "Property type mismatch";
         }
+        return "Unknown property status";
+    }
 
-        bool operator<(const PropertyMeta& other) const
+    // ԼԣĹϣֵȽϼǷ
+    // ͨð汾ֻKeyTypeתΪKeyTypeͣ
+    template<typename KeyType, typename KeyHash, typename KeyEqual>
+    struct PropertyKeyTraits
+    {
+        // ǷԲKeyTypeֱLookupKey
+        template<typename LookupKey>
+        static constexpr bool IsHeterogeneous = false;
+
+        static size_t Hash(const KeyType& key)
         {
-            return registrationOrder < other.registrationOrder;
+            return KeyHash()(key);
         }
-    };
 
-    // ΪPropertyMetaṩϣ֧
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        struct PropertyMetaHash
-    {
-        size_t operator()(const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& prop) const
+        static bool Equal(const KeyType& key, const KeyType& lookupKey)
         {
-            KeyHash hash;
-            return hash(prop.name) ^
-                (std::hash<StringType>()(prop.className) << 1) ^
-                (std::hash<int>()(static_cast<int>(prop.enumType)) << 2);
+            return KeyEqual()(key, lookupKey);
         }
     };
 
-    // 
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        using PropertyMap = std::unordered_map<KeyType,
-        PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>, KeyHash, KeyEqual>;
-
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        using PropertyMultiMap = std::unordered_multimap<KeyType,
-        PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>, KeyHash, KeyEqual>;
-
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        using PropertyList = std::vector<PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
-
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        using PropertySet = std::unordered_set<
-        PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>,
-        PropertyMetaHash<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
-
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        using ClassNameList = std::vector<StringType>;
-
-    // ݽṹ - о̬ݽṹϲ
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        struct PropertyData
+    // std::basic_stringʹstd::hashstd::equal_to֧basic_string_viewconst CharT*칹
+    // ׼֤hash<basic_string_view>hash<basic_string>ͬݵĹϣֵһ£˲ʱ蹹ʱַ
+    template<typename CharT, typename Alloc>
+    struct PropertyKeyTraits<std::basic_string<CharT, std::char_traits<CharT>, Alloc>,
+        std::hash<std::basic_string<CharT, std::char_traits<CharT>, Alloc>>,
+        std::equal_to<std::basic_string<CharT, std::char_traits<CharT>, Alloc>>>
     {
-        // ӳ
-        PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> ownPropertyMap;          // ӳ
-        PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> directPropertyMap;       // ֱӳO(1)ң
-        std::unordered_map<StringType,
-            PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> parentPropertyMaps; // ӳ -> Ա
-        PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> combinedPropertyMap;     // ϲԱ
-
-        // Զӳͬԣ
-        PropertyMultiMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allPropertiesMultiMap;
-
-        // б
-        PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> ownPropertiesList;      // бע˳
-        PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allPropertiesList;      // б̳еģͬ
+        using KeyType = std::basic_string<CharT, std::char_traits<CharT>, Alloc>;
+        using ViewType = std::basic_string_view<CharT, std::char_traits<CharT>>;
 
-        // 
-        std::vector<KeyType> orderedPropertyNames;                                             // ԰ע˳б
-        std::unordered_map<StringType, std::vector<KeyType>> parentOrderedPropertyNames;      // б
+        template<typename LookupKey>
+        static constexpr bool IsHeterogeneous =
+            std::is_convertible_v<const LookupKey&, ViewType> && !std::is_same_v<std::decay_t<LookupKey>, KeyType>;
 
-        // бӳ
-        std::unordered_map<StringType,
-            PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> parentPropertiesListMap;
-
-        // б̳˳ֱӸǰԶں
-        ClassNameList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allParentsName;
-
-        // ѡбӳ䣨洢
-        std::unordered_map<StringType, std::unordered_map<KeyType, std::vector<StringType>>> optionalPropertyMap;
-
-        // ӳ洢
-        std::unordered_map<StringType, std::unordered_map<KeyType, StringType>> descriptionMap;
-
-        // ע
-        size_t registrationCounter = 0;
+        static size_t Hash(ViewType key)
+        {
+            return std::hash<ViewType>()(key);
+        }
 
-        // ʼ־
-        bool initialized = false;
+        static bool Equal(const KeyType& key, ViewType lookupKey)
+        {
+            return ViewType(key) == lookupKey;
+        }
     };
 
-    // ѡ̳࣬Propertyṩѡع
-    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
-        typename KeyToString, typename StringType, typename ErrorCallback>
-        class OptionalProperty : public Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>
+    //  -> ID
+    // ԼFINALIZE_PROPERTY_SYSTEMٱ仯˹ʱСϣhash-and-displace
+    // ʱͰλֱΨһλֻһ̽һμȽϣûгͻ
+    // ĹϣֵȫͬԶKeyHash޷ϣ˻ΪѰַ̽
+    // ֻϣֵָԪƵָIDʱֱʹ칹ڴ
+    template<typename KeyType, typename KeyHash, typename KeyEqual>
+    class PropertyNameIndex
     {
     public:
-        using BasePropertyType = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using KeyTraits = PropertyKeyTraits<KeyType, KeyHash, KeyEqual>;
 
-        // ĬϹ캯 - ЧĿѡ
-        OptionalProperty() : BasePropertyType()
+        // ID˳ԱֵģģͬԸȳֵ
+        template<typename MetaPointer>
+        void Build(const std::vector<MetaPointer>& propertyTable)
         {
+            BuildProbeTable(propertyTable);
+            BuildPerfectHash();
         }
 
-        OptionalProperty(const BasePropertyType& prop)
-            : BasePropertyType(prop)
+        // IDҲʱInvalidPropertyId
+        template<typename LookupKey>
+        PropertyId Find(const LookupKey& lookupKey) const
         {
-            // PropertyDataлȡѡб
-            InitializeOptionList();
+            if (m_entries.empty())
+                return InvalidPropertyId;
+
+            size_t hash = KeyTraits::Hash(lookupKey);
+            if (!m_seeds.empty())
+            {
+                // ϣ̽
+                uint32_t seed = m_seeds[Reduce(Mix(hash, 0), m_seeds.size())];
+                const Entry& entry = m_entries[Reduce(Mix(hash, seed), m_entries.size())];
+                return (entry.hash == hash && KeyTraits::Equal(*entry.key, lookupKey)) ? entry.id : InvalidPropertyId;
+            }
+
+            // ˻·̽
+            size_t index = Reduce(Mix(hash, 0), m_entries.size());
+            while (m_entries[index].key)
+            {
+                if (m_entries[index].hash == hash && KeyTraits::Equal(*m_entries[index].key, lookupKey))
+                {
+                    return m_entries[index].id;
+                }
+                index = (index + 1 == m_entries.size()) ? 0 : index + 1;
+            }
+            return InvalidPropertyId;
         }
 
-        OptionalProperty(const OptionalProperty& other)
-            : BasePropertyType(other), m_optionList(other.m_optionList)
+        // ظ
+        size_t Size() const
         {
+            return m_size;
         }
 
-        OptionalProperty& operator=(const OptionalProperty& other)
+        // Ƿɹϣ
+        bool IsPerfect() const
         {
-            if (this != &other)
-            {
-                BasePropertyType::operator=(other);
-                m_optionList = other.m_optionList;
-            }
-            return *this;
+            return !m_seeds.empty();
         }
 
-        // ȡǰѡַ
-        StringType GetOptionString() const
+        void Clear()
         {
-            if (!this->IsValid())
-                return StringType{};
+            m_entries.clear();
+            m_seeds.clear();
+            m_size = 0;
+        }
 
-            // ͨgetterȡѡֵ
-            int currentValue = this->template GetValue<int>();
+    private:
+        struct Entry
+        {
+            size_t hash;
+            const KeyType* key;
+            PropertyId id;
+        };
 
-            // ڵǰѡбв
-            auto classOptions = GetOptionListForThisClass();
-            if (currentValue >= 0 && currentValue < static_cast<int>(classOptions.size()))
+        // ӻϹϣֵΪ0ʱѡͰ
+        static uint32_t Mix(size_t hash, uint32_t seed)
+        {
+            uint64_t x = static_cast<uint64_t>(hash) ^ (static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ull);
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            return static_cast<uint32_t>(x);
+        }
+
+        // 32λֵӳ䵽[0, range)ó˷ȡģ
+        static size_t Reduce(uint32_t value, size_t range)
+        {
+            return static_cast<size_t>((static_cast<uint64_t>(value) * static_cast<uint64_t>(range)) >> 32);
+        }
+
+        // ѰַװӲ0.5ͬʱͬԵȥ
+        template<typename MetaPointer>
+        void BuildProbeTable(const std::vector<MetaPointer>& propertyTable)
+        {
+            Clear();
+            m_entries.assign((std::max)(propertyTable.size() * 2, size_t(4)), Entry{ 0, nullptr, InvalidPropertyId });
+
+            for (size_t id = 0; id < propertyTable.size(); ++id)
             {
-                return classOptions[currentValue];
+                const KeyType& key = propertyTable[id]->name;
+                size_t hash = KeyTraits::Hash(key);
+                size_t index = Reduce(Mix(hash, 0), m_entries.size());
+                while (m_entries[index].key && !(m_entries[index].hash == hash && KeyTraits::Equal(*m_entries[index].key, key)))
+                {
+                    index = (index + 1 == m_entries.size()) ? 0 : index + 1;
+                }
+
+                if (!m_entries[index].key)
+                {
+                    ++m_size;
+                }
+                m_entries[index] = Entry{ hash, &key, static_cast<PropertyId>(id) };
             }
+        }
 
-            // ûҵѡбв
-            if (currentValue >= 0 && currentValue < static_cast<int>(m_optionList.size()))
+        // ȥغļϹСϣʧʱѰַ
+        void BuildPerfectHash()
+        {
+            std::vector<Entry> keys;
+            keys.reserve(m_size);
+            for (const auto& entry : m_entries)
             {
-                return m_optionList[currentValue];
+                if (entry.key)
+                    keys.push_back(entry);
             }
+            if (keys.empty())
+                return;
 
-            return StringType{};
+            const size_t slotCount = keys.size();
+            const size_t bucketCount = (slotCount + 1) / 2;
+            const uint32_t maxSeed = 1u << 20;
+
+            // Ͱ飬ȷýϴͰ
+            std::vector<std::vector<size_t>> buckets(bucketCount);
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                buckets[Reduce(Mix(keys[i].hash, 0), bucketCount)].push_back(i);
+            }
+            std::vector<size_t> bucketOrder(bucketCount);
+            for (size_t i = 0; i < bucketCount; ++i)
+            {
+                bucketOrder[i] = i;
+            }
+            std::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+                [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+            std::vector<uint32_t> seeds(bucketCount, 1);
+            std::vector<Entry> slots(slotCount, Entry{ 0, nullptr, InvalidPropertyId });
+            std::vector<size_t> candidate;
+            for (size_t bucketIndex : bucketOrder)
+            {
+                const auto& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                    break;
+
+                bool placed = false;
+                for (uint32_t seed = 1; seed < maxSeed && !placed; ++seed)
+                {
+                    candidate.clear();
+                    placed = true;
+                    for (size_t keyIndex : bucket)
+                    {
+                        size_t slot = Reduce(Mix(keys[keyIndex].hash, seed), slotCount);
+                        if (slots[slot].key || std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        candidate.push_back(slot);
+                    }
+
+                    if (placed)
+                    {
+                        seeds[bucketIndex] = seed;
+                        for (size_t i = 0; i < bucket.size(); ++i)
+                        {
+                            slots[candidate[i]] = keys[bucket[i]];
+                        }
+                    }
+                }
+
+                // Ͱڴڹϣֵȫͬļ޷
+                if (!placed)
+                    return;
+            }
+
+            m_entries.swap(slots);
+            m_seeds.swap(seeds);
         }
 
-        // ȡѡбǰ+иࣩ
-        const std::vector<StringType>& GetOptionList() const
+        std::vector<Entry> m_entries;
+        std::vector<uint32_t> m_seeds;   // ÿͰλӣΪձʾʹÿѰַ˻·
+        size_t m_size = 0;
+    };
+
+    // ڴֻͼC++17ûstd::span㿽ȡvector/array/string͵
+    template<typename T>
+    class PropertySpan
+    {
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using iterator = T*;
+        using const_iterator = T*;
+
+        PropertySpan() : m_data(nullptr), m_size(0)
         {
-            return m_optionList;
         }
 
-        // ַͨѡ
-        bool SetOptionByString(const StringType& optionStr)
+        PropertySpan(T* data, size_t size) : m_data(data), m_size(size)
         {
-            if (!this->IsValid())
+        }
+
+        T* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T* begin() const { return m_data; }
+        T* end() const { return m_data + m_size; }
+        T& operator[](size_t index) const { return m_data[index]; }
+
+    private:
+        T* m_data;
+        size_t m_size;
+    };
+
+    // ͲֵעʱʵPropertyMeta֪̬͵д·ʹ
+    template<typename T>
+    struct PropertyValueOps
+    {
+        static void CopyAssign(void* dst, const void* src)
+        {
+            *static_cast<T*>(dst) = *static_cast<const T*>(src);
+        }
+
+        static void MoveAssign(void* dst, void* src)
+        {
+            *static_cast<T*>(dst) = std::move(*static_cast<T*>(src));
+        }
+
+        // srcʱ󽻸sinkԶͨsinksettersetterֻƶʱ
+        static void CopyInto(const void* src, void (*sink)(void* context, void* value), void* context)
+        {
+            T temp = *static_cast<const T*>(src);
+            sink(context, &temp);
+        }
+    };
+
+    // ѡԵͲдѡֵöͣͳһintд
+    template<typename T>
+    struct PropertyOptionOps
+    {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Optional property must be an integral or enum type");
+        static_assert(sizeof(T) <= sizeof(long long), "Optional property type is too large");
+
+        static int ReadIndex(const void* src)
+        {
+            return static_cast<int>(*static_cast<const T*>(src));
+        }
+
+        // dstֵΪindexTdstΪֶεַsizeof(long long)ֽڡlong longʱ洢
+        static void ConstructFromIndex(void* dst, int index)
+        {
+            ::new (dst) T(static_cast<T>(index));
+        }
+    };
+
+    // Ʊʹõֽڻ
+    using PropertyBinaryBuffer = std::vector<uint8_t>;
+
+    // ƶдĻߣֽд/ԭʼֽںͳ
+    struct PropertyBinaryIO
+    {
+        static void WriteBytes(PropertyBinaryBuffer& buffer, const void* data, size_t size)
+        {
+            if (size == 0)
+                return;
+            const size_t start = buffer.size();
+            buffer.resize(start + size);
+            std::memcpy(buffer.data() + start, data, size);
+        }
+
+        static bool ReadBytes(const uint8_t*& cursor, const uint8_t* end, void* data, size_t size)
+        {
+            if (static_cast<size_t>(end - cursor) < size)
                 return false;
+            if (size != 0)
+                std::memcpy(data, cursor, size);
+            cursor += size;
+            return true;
+        }
 
-            // ڵǰѡбв
-            auto classOptions = GetOptionListForThisClass();
-            for (size_t i = 0; i < classOptions.size(); ++i)
+        static void WriteSize(PropertyBinaryBuffer& buffer, size_t size)
+        {
+            const uint64_t value = static_cast<uint64_t>(size);
+            WriteBytes(buffer, &value, sizeof(value));
+        }
+
+        static bool ReadSize(const uint8_t*& cursor, const uint8_t* end, size_t& size)
+        {
+            uint64_t value = 0;
+            if (!ReadBytes(cursor, end, &value, sizeof(value)))
+                return false;
+            size = static_cast<size_t>(value);
+            return true;
+        }
+    };
+
+    // Ʊд/ֽڻ
+    // Ĭֿ֧ƽƵָͣ⣩ַԼԪؿɱstd::vectorͿROPռػ
+    // static constexpr bool Supported = true; static constexpr bool Bitwise = false;
+    // static void Write(const T&, PropertyBinaryBuffer&); static bool Read(T&, const uint8_t*& cursor, const uint8_t* end);
+    template<typename T, typename = void>
+    struct PropertyBinaryTraits
+    {
+        static constexpr bool Supported = false;
+        static constexpr bool Bitwise = false;
+    };
+
+    // ƽƵֽͣԭƣBitwiseΪtrueʱлƻ԰ֶκϲΪһmemcpy
+    template<typename T>
+    struct PropertyBinaryTraits<T, std::enable_if_t<std::is_trivially_copyable_v<T> &&
+        !std::is_pointer_v<T> && !std::is_member_pointer_v<T>>>
+    {
+        static constexpr bool Supported = true;
+        static constexpr bool Bitwise = true;
+
+        static void Write(const T& value, PropertyBinaryBuffer& buffer)
+        {
+            PropertyBinaryIO::WriteBytes(buffer, &value, sizeof(T));
+        }
+
+        static bool Read(T& value, const uint8_t*& cursor, const uint8_t* end)
+        {
+            return PropertyBinaryIO::ReadBytes(cursor, end, &value, sizeof(T));
+        }
+    };
+
+    // ַ + ַ
+    template<typename CharT, typename Traits, typename Alloc>
+    struct PropertyBinaryTraits<std::basic_string<CharT, Traits, Alloc>, std::enable_if_t<std::is_trivially_copyable_v<CharT>>>
+    {
+        static constexpr bool Supported = true;
+        static constexpr bool Bitwise = false;
+
+        static void Write(const std::basic_string<CharT, Traits, Alloc>& value, PropertyBinaryBuffer& buffer)
+        {
+            PropertyBinaryIO::WriteSize(buffer, value.size());
+            PropertyBinaryIO::WriteBytes(buffer, value.data(), value.size() * sizeof(CharT));
+        }
+
+        static bool Read(std::basic_string<CharT, Traits, Alloc>& value, const uint8_t*& cursor, const uint8_t* end)
+        {
+            size_t length = 0;
+            if (!PropertyBinaryIO::ReadSize(cursor, end, length) || length > static_cast<size_t>(end - cursor) / sizeof(CharT))
+                return false;
+            value.resize(length);
+            return PropertyBinaryIO::ReadBytes(cursor, end, &value[0], length * sizeof(CharT));
+        }
+    };
+
+    // 飺Ԫظ + ԪݣԪؿɰֽڸʱ帴ƣ
+    template<typename E, typename Alloc>
+    struct PropertyBinaryTraits<std::vector<E, Alloc>, std::enable_if_t<PropertyBinaryTraits<E>::Supported && !std::is_same_v<E, bool>>>
+    {
+        static constexpr bool Supported = true;
+        static constexpr bool Bitwise = false;
+
+        static void Write(const std::vector<E, Alloc>& value, PropertyBinaryBuffer& buffer)
+        {
+            PropertyBinaryIO::WriteSize(buffer, value.size());
+            if constexpr (PropertyBinaryTraits<E>::Bitwise)
             {
-                if (classOptions[i] == optionStr)
-                {
-                    // ҵӦͨsetterֵ
-                    this->SetValue<int>(static_cast<int>(i));
-                    return true;
-                }
+                PropertyBinaryIO::WriteBytes(buffer, value.data(), value.size() * sizeof(E));
             }
-
-            // ûҵѡбв
-            for (size_t i = 0; i < m_optionList.size(); ++i)
+            else
             {
-                if (m_optionList[i] == optionStr)
+                for (const E& element : value)
                 {
-                    // ҵӦͨsetterֵ
-                    this->SetValue<int>(static_cast<int>(i));
-                    return true;
+                    PropertyBinaryTraits<E>::Write(element, buffer);
                 }
             }
-
-            return false;
         }
 
-        // ͨѡ
-        bool SetOptionByIndex(int index)
+        static bool Read(std::vector<E, Alloc>& value, const uint8_t*& cursor, const uint8_t* end)
         {
-            if (!this->IsValid())
+            size_t count = 0;
+            if (!PropertyBinaryIO::ReadSize(cursor, end, count))
                 return false;
-
-            auto classOptions = GetOptionListForThisClass();
-            if (index >= 0 && index < static_cast<int>(classOptions.size()))
+            if constexpr (PropertyBinaryTraits<E>::Bitwise)
             {
-                this->SetValue<int>(index);
-                return true;
+                if (count > static_cast<size_t>(end - cursor) / sizeof(E))
+                    return false;
+                value.resize(count);
+                return PropertyBinaryIO::ReadBytes(cursor, end, value.data(), count * sizeof(E));
             }
-
-            if (index >= 0 && index < static_cast<int>(m_optionList.size()))
+            else
             {
-                this->SetValue<int>(index);
+                // ԪظݣԤȷ䳬ʣֽĿռ
+                value.clear();
+                value.reserve(std::min(count, static_cast<size_t>(end - cursor)));
+                for (size_t i = 0; i < count; ++i)
+                {
+                    value.emplace_back();
+                    if (!PropertyBinaryTraits<E>::Read(value.back(), cursor, end))
+                        return false;
+                }
                 return true;
             }
+        }
+    };
 
-            return false;
+    // ͲĶƱ룺עʱʵPropertyMetaлƻʹ
+    template<typename T>
+    struct PropertyBinaryOps
+    {
+        static void Write(const void* src, PropertyBinaryBuffer& buffer)
+        {
+            PropertyBinaryTraits<T>::Write(*static_cast<const T*>(src), buffer);
         }
 
-        // Ƿѡ
-        bool IsOptional() const
+        static bool Read(void* dst, const uint8_t*& cursor, const uint8_t* end)
         {
-            if (!this->IsValid())
+            return PropertyBinaryTraits<T>::Read(*static_cast<T*>(dst), cursor, end);
+        }
+
+        // 뵽ʱ󽻸sinkԶͨsinksetter
+        static bool ReadInto(const uint8_t*& cursor, const uint8_t* end, void (*sink)(void* context, void* value), void* context)
+        {
+            T value{};
+            if (!PropertyBinaryTraits<T>::Read(value, cursor, end))
                 return false;
+            sink(context, &value);
+            return true;
+        }
 
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
-            return meta && meta->isOptional;
+        // TĶƱ뺯дԪݣͲֶ֧ƱʱΪգ
+        template<typename MetaType>
+        static void AssignTo(MetaType& meta)
+        {
+            meta.valueSize = sizeof(T);
+            if constexpr (PropertyBinaryTraits<T>::Supported)
+            {
+                meta.isBitwiseSerializable = PropertyBinaryTraits<T>::Bitwise;
+                meta.writeBinary = &Write;
+                meta.readBinary = &Read;
+                if constexpr (std::is_default_constructible_v<T>)
+                {
+                    meta.readBinaryInto = &ReadInto;
+                }
+            }
         }
+    };
 
-        // ȡѡ
-        size_t GetOptionCount() const
+    // Ͳֵãдӿݲͬ͵ֵֻ¼ֵĵַID
+    // õĶдڼЧ
+    class PropertyValueRef
+    {
+    public:
+        PropertyValueRef() : m_ptr(nullptr), m_typeId(0)
         {
-            return m_optionList.size();
         }
 
+        template<typename T, typename = std::enable_if_t<!std::is_const_v<T> && !std::is_same_v<T, PropertyValueRef>>>
+        PropertyValueRef(T& value) : m_ptr(&value), m_typeId(GetPropertyTypeId<T>())
+        {
+        }
+
+        void* GetPointer() const { return m_ptr; }
+        PropertyTypeId GetTypeId() const { return m_typeId; }
+
     private:
-        // ȡǰѡбPropertyDataвң
-        std::vector<StringType> GetOptionListForThisClass() const
+        void* m_ptr;
+        PropertyTypeId m_typeId;
+    };
+
+    // ǰ
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class PropertyObject;
+
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        struct PropertyMeta;
+
+    // ģ࣬װԺö
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class Property
+    {
+    public:
+        using ErrorCallbackType = ErrorCallback;
+
+        // ĬϹ캯 - Ч
+        Property() : m_type(EnumType{}), m_metaPtr(nullptr), m_objPtr(nullptr)
         {
-            if (!this->IsValid())
-                return {};
+        }
 
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
-            if (!meta || !meta->isOptional)
-                return {};
+        Property(const EnumType type, const void* metaPtr,
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* objPtr)
+            : m_type(type), m_metaPtr(metaPtr), m_objPtr(objPtr)
+        {
+        }
 
-            auto* obj = this->GetObject();
-            if (!obj)
-                return {};
+        // жǷЧ
+        bool IsValid() const
+        {
+            return m_metaPtr != nullptr && m_objPtr != nullptr;
+        }
 
-            // ͨPropertyDataȡѡб
-            auto& propertyData = obj->GetPropertyData();
-            auto classIt = propertyData.optionalPropertyMap.find(meta->className);
-            if (classIt != propertyData.optionalPropertyMap.end())
+        // ȡö
+        EnumType GetType() const
+        {
+            if (CheckedAccess && !IsValid())
             {
-                auto propIt = classIt->second.find(meta->name);
-                if (propIt != classIt->second.end())
-                {
-                    return propIt->second;
-                }
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot get type");
+                throw std::runtime_error("Invalid property: cannot get type");
+            }
+            return m_type;
+        }
+
+        // ȡֵָͣ
+        template<typename T>
+        T GetValue() const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot get value");
+                throw std::runtime_error("Invalid property: cannot get value");
+            }
+            return m_objPtr->template GetPropertyValue<T>(m_metaPtr);
+        }
+
+        // ֵָͣ
+        template<typename T>
+        void SetValue(const T& value)
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot set value");
+                throw std::runtime_error("Invalid property: cannot set value");
             }
+            m_objPtr->template SetPropertyValue<T>(m_metaPtr, value);
+        }
+
+        // ֵֵ汾ֵƶУ
+        template<typename T, typename = std::enable_if_t<!std::is_reference_v<T>>>
+        void SetValue(T&& value)
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot set value");
+                throw std::runtime_error("Invalid property: cannot set value");
+            }
+            m_objPtr->template SetPropertyValue<T>(m_metaPtr, std::move(value));
+        }
+
+        // Իȡöͣ󣬲쳣
+        PropertyStatus TryGetType(EnumType& out) const
+        {
+            if (!IsValid())
+                return PropertyStatus::InvalidProperty;
+            out = m_type;
+            return PropertyStatus::Ok;
+        }
+
+        // Իȡֵɹʱдoutʧʱ״̬Ҳ޸out
+        // ROP_DISABLE_TYPE_CHECKӰ죬Ǽ
+        template<typename T>
+        PropertyStatus TryGetValue(T& out) const
+        {
+            PropertyStatus status = CheckAccess<T>();
+            if (status != PropertyStatus::Ok)
+                return status;
+            out = *static_cast<const T*>(m_objPtr->GetPropertyPointer(m_metaPtr));
+            return PropertyStatus::Ok;
+        }
+
+        // ֵʧʱ״̬Ҳ޸
+        template<typename T>
+        PropertyStatus TrySetValue(const T& value)
+        {
+            PropertyStatus status = CheckAccess<T>();
+            if (status != PropertyStatus::Ok)
+                return status;
+            m_objPtr->template SetPropertyValue<T>(m_metaPtr, value);
+            return PropertyStatus::Ok;
+        }
+
+        // ֵֵ汾ɹʱֵƶУ
+        template<typename T, typename = std::enable_if_t<!std::is_reference_v<T>>>
+        PropertyStatus TrySetValue(T&& value)
+        {
+            PropertyStatus status = CheckAccess<T>();
+            if (status != PropertyStatus::Ok)
+                return status;
+            m_objPtr->template SetPropertyValue<T>(m_metaPtr, std::move(value));
+            return PropertyStatus::Ok;
+        }
+
+        // ȡֵָ루ЧͲƥʱnullptr
+        template<typename T>
+        T* GetPointer()
+        {
+            if (!IsValid() || !CheckType<T>())
+                return nullptr;
+            void* ptr = m_objPtr->GetPropertyPointer(m_metaPtr);
+            return static_cast<T*>(ptr);
+        }
+
+        // ȡֵ
+        template<typename T>
+        T& GetReference()
+        {
+            if constexpr (!CheckedAccess)
+            {
+                return *static_cast<T*>(m_objPtr->GetPropertyPointer(m_metaPtr));
+            }
+            T* ptr = GetPointer<T>();
+            if (!ptr)
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::NullReference, "Failed to get property reference");
+                throw std::runtime_error("Failed to get property reference");
+            }
+            return *ptr;
+        }
+
+        // ȡֵĳ
+        template<typename T>
+        const T& GetConstReference() const
+        {
+            if constexpr (!CheckedAccess)
+            {
+                return *static_cast<const T*>(m_objPtr->GetPropertyPointer(m_metaPtr));
+            }
+            const T* ptr = GetConstPointer<T>();
+            if (!ptr)
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::NullReference, "Failed to get property const reference");
+                throw std::runtime_error("Failed to get property const reference");
+            }
+            return *ptr;
+        }
+
+        // ȡֵĳָ루ЧͲƥʱnullptr
+        template<typename T>
+        const T* GetConstPointer() const
+        {
+            if (!IsValid() || !CheckType<T>())
+                return nullptr;
+            const void* ptr = m_objPtr->GetPropertyPointer(m_metaPtr);
+            return static_cast<const T*>(ptr);
+        }
+
+        // ȡַԵֻͼַΪstd::basic_string<CharT>
+        // ͼֵ޸ĻǰЧ
+        template<typename CharT = char, typename Traits = std::char_traits<CharT>, typename Alloc = std::allocator<CharT>>
+        std::basic_string_view<CharT, Traits> GetStringView() const
+        {
+            return std::basic_string_view<CharT, Traits>(GetConstReference<std::basic_string<CharT, Traits, Alloc>>());
+        }
+
+        // ȡԣstd::vectorstd::arrayֻͼԪ
+        // ContainerΪԵעͣͼ޸ĻǰЧ
+        template<typename Container>
+        PropertySpan<const typename Container::value_type> GetSpan() const
+        {
+            const Container& container = GetConstReference<Container>();
+            return PropertySpan<const typename Container::value_type>(container.data(), container.size());
+        }
+
+        // ȡԪָ
+        const void* GetMetaPtr() const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot get meta pointer");
+                throw std::runtime_error("Invalid property: cannot get meta pointer");
+            }
+            return m_metaPtr;
+        }
+
+        // ȡ
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetObject() const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property: cannot get object");
+                throw std::runtime_error("Invalid property: cannot get object");
+            }
+            return m_objPtr;
+        }
+
+        // ȡ
+        StringType GetDescription() const
+        {
+            if (!IsValid())
+                return StringType{};
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
+            return meta ? meta->description : StringType{};
+        }
+
+        // ȡƣKeyType
+        KeyType GetName() const
+        {
+            if (!IsValid())
+                return KeyType{};
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
+            return meta ? meta->name : KeyType{};
+        }
+
+        // ȡַʹKeyToStringת
+        StringType GetNameString() const
+        {
+            if (!IsValid())
+                return StringType{};
+
+            KeyType name = GetName();
+            return KeyToString()(name);
+        }
+
+        // ȡID
+        PropertyId GetId() const
+        {
+            if (!IsValid())
+                return InvalidPropertyId;
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
+            return meta ? meta->propertyId : InvalidPropertyId;
+        }
+
+        // ȡ
+        StringType GetClassName() const
+        {
+            if (!IsValid())
+                return StringType{};
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr);
+            return meta ? meta->className : StringType{};
+        }
+
+    private:
+        // ʲԣPropertyAccessPolicy
+        static constexpr bool CheckedAccess = PropertyAccessPolicy<EnumType>::Checked;
+        static constexpr bool CheckedType = CheckedAccess && PropertyTypeCheckEnabled;
+
+        // עǷΪTROP_DISABLE_TYPE_CHECKʱǷtrue
+        template<typename T>
+        bool CheckType() const
+        {
+            return !PropertyTypeCheckEnabled ||
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr)->template IsType<T>();
+        }
+
+        // Tryϵнӿڵǰü飺ЧעΪTʱOk
+        template<typename T>
+        PropertyStatus CheckAccess() const
+        {
+            if (!IsValid())
+                return PropertyStatus::InvalidProperty;
+            if (!static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(m_metaPtr)->template IsType<T>())
+                return PropertyStatus::TypeMismatch;
+            return PropertyStatus::Ok;
+        }
+
+        EnumType m_type;
+        const void* m_metaPtr;
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_objPtr;
+    };
+
+    // Ԫ
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        struct PropertyMeta
+    {
+        KeyType name;
+        EnumType enumType;
+        StringType typeName;
+        size_t offset;
+        ptrdiff_t fieldOffset = 0;     // ֶPropertyObjectӶƫƣֱӷʿ·ʹã
+        StringType className;
+        std::function<void* (PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*)> getter;
+        // settervalueָ÷׼ʱ󣨻÷ֵĶ󣩣setterԴƶ
+        std::function<void(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*, void*)> setter;
+        bool isCustomAccessor;
+        size_t registrationOrder = 0;
+
+        // IDFINALIZE_PROPERTY_SYSTEMʱ䣩
+        PropertyId propertyId = InvalidPropertyId;
+
+        // ע͵ID
+        PropertyTypeId typeId = 0;
+
+        // ͲĸֵPropertyValueOpsдʹ
+        void (*copyAssign)(void* dst, const void* src) = nullptr;
+        void (*moveAssign)(void* dst, void* src) = nullptr;
+        void (*copyInto)(const void* src, void (*sink)(void* context, void* value), void* context) = nullptr;
+
+        // ֵĴСԼֽܷԭ루лƻݴ˺ϲֶΣ
+        size_t valueSize = 0;
+        bool isBitwiseSerializable = false;
+
+        // ͲĶƱ뺯PropertyBinaryOpsͲֶ֧ƱʱΪ
+        void (*writeBinary)(const void* src, PropertyBinaryBuffer& buffer) = nullptr;
+        bool (*readBinary)(void* dst, const uint8_t*& cursor, const uint8_t* end) = nullptr;
+        bool (*readBinaryInto)(const uint8_t*& cursor, const uint8_t* end, void (*sink)(void* context, void* value), void* context) = nullptr;
+
+        // ǷΪѡԱ־
+        bool isOptional = false;
+
+        // ѡԵдPropertyOptionOpsѡΪ
+        int (*readOptionIndex)(const void* src) = nullptr;
+        void (*constructOptionValue)(void* dst, int index) = nullptr;
+
+        // 
+        StringType description;
+
+        // עǷΪT
+        template<typename T>
+        bool IsType() const
+        {
+            return typeId == GetPropertyTypeId<T>();
+        }
+
+        bool operator==(const PropertyMeta& other) const
+        {
+            KeyEqual equal;
+            return equal(name, other.name) && className == other.className && enumType == other.enumType;
+        }
+
+        bool operator<(const PropertyMeta& other) const
+        {
+            return registrationOrder < other.registrationOrder;
+        }
+    };
+
+    // ΪPropertyMetaṩϣ֧
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        struct PropertyMetaHash
+    {
+        size_t operator()(const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& prop) const
+        {
+            KeyHash hash;
+            return hash(prop.name) ^
+                (std::hash<StringType>()(prop.className) << 1) ^
+                (std::hash<int>()(static_cast<int>(prop.enumType)) << 2);
+        }
+    };
+
+    // ==================== Ԫ ====================
+    // ԪֻPropertyData::propertyArenaдһݣָֻеָ
+    // ʱֱӽΪԪݣӳΪ<, Ԫ>öԣ÷ԭԪݸı׼һ
+
+    // Ԫָбĵ
+    template<typename BaseIterator, typename MetaType>
+    class PropertyMetaListIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = MetaType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const MetaType*;
+        using reference = const MetaType&;
+
+        PropertyMetaListIterator() = default;
+        explicit PropertyMetaListIterator(BaseIterator it) : m_it(it) {}
+
+        reference operator*() const { return **m_it; }
+        pointer operator->() const { return *m_it; }
+        reference operator[](difference_type n) const { return *m_it[n]; }
+
+        PropertyMetaListIterator& operator++() { ++m_it; return *this; }
+        PropertyMetaListIterator operator++(int) { PropertyMetaListIterator tmp = *this; ++m_it; return tmp; }
+        PropertyMetaListIterator& operator--() { --m_it; return *this; }
+        PropertyMetaListIterator operator--(int) { PropertyMetaListIterator tmp = *this; --m_it; return tmp; }
+        PropertyMetaListIterator& operator+=(difference_type n) { m_it += n; return *this; }
+        PropertyMetaListIterator& operator-=(difference_type n) { m_it -= n; return *this; }
+        PropertyMetaListIterator operator+(difference_type n) const { return PropertyMetaListIterator(m_it + n); }
+        PropertyMetaListIterator operator-(difference_type n) const { return PropertyMetaListIterator(m_it - n); }
+        difference_type operator-(const PropertyMetaListIterator& other) const { return m_it - other.m_it; }
+
+        bool operator==(const PropertyMetaListIterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const PropertyMetaListIterator& other) const { return m_it != other.m_it; }
+        bool operator<(const PropertyMetaListIterator& other) const { return m_it < other.m_it; }
+
+    private:
+        BaseIterator m_it;
+    };
+
+    // Ԫָб˳򱣴Ԫָ룩
+    template<typename MetaType>
+    class PropertyMetaList
+    {
+    public:
+        using value_type = MetaType;
+        using const_iterator = PropertyMetaListIterator<typename std::vector<const MetaType*>::const_iterator, MetaType>;
+        using iterator = const_iterator;
+
+        const_iterator begin() const { return const_iterator(m_items.begin()); }
+        const_iterator end() const { return const_iterator(m_items.end()); }
+        size_t size() const { return m_items.size(); }
+        bool empty() const { return m_items.empty(); }
+        const MetaType& operator[](size_t index) const { return *m_items[index]; }
+        const MetaType& front() const { return *m_items.front(); }
+        const MetaType& back() const { return *m_items.back(); }
+
+        void push_back(const MetaType* meta) { m_items.push_back(meta); }
+        void reserve(size_t count) { m_items.reserve(count); }
+        void clear() { m_items.clear(); }
+
+        // ײָ
+        const std::vector<const MetaType*>& Pointers() const { return m_items; }
+
+    private:
+        std::vector<const MetaType*> m_items;
+    };
+
+    // ԪָӳļԪеƣƼ
+    template<typename KeyType>
+    struct PropertyMetaKeyRef
+    {
+        const KeyType* key;
+    };
+
+    template<typename KeyType, typename KeyHash>
+    struct PropertyMetaKeyRefHash
+    {
+        size_t operator()(const PropertyMetaKeyRef<KeyType>& ref) const
+        {
+            return KeyHash()(*ref.key);
+        }
+    };
+
+    template<typename KeyType, typename KeyEqual>
+    struct PropertyMetaKeyRefEqual
+    {
+        bool operator()(const PropertyMetaKeyRef<KeyType>& a, const PropertyMetaKeyRef<KeyType>& b) const
+        {
+            return KeyEqual()(*a.key, *b.key);
+        }
+    };
+
+    // Ԫָӳĵõõ<, Ԫ>ö
+    template<typename BaseIterator, typename KeyType, typename MetaType>
+    class PropertyMetaMapIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const KeyType&, const MetaType&>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        // operator->صĴ
+        struct pointer
+        {
+            value_type value;
+            const value_type* operator->() const { return &value; }
+        };
+
+        PropertyMetaMapIterator() = default;
+        explicit PropertyMetaMapIterator(BaseIterator it) : m_it(it) {}
+
+        reference operator*() const { return value_type(*m_it->first.key, *m_it->second); }
+        pointer operator->() const { return pointer{ **this }; }
+
+        PropertyMetaMapIterator& operator++() { ++m_it; return *this; }
+        PropertyMetaMapIterator operator++(int) { PropertyMetaMapIterator tmp = *this; ++m_it; return tmp; }
+
+        bool operator==(const PropertyMetaMapIterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const PropertyMetaMapIterator& other) const { return m_it != other.m_it; }
+
+    private:
+        BaseIterator m_it;
+    };
+
+    // Ԫָӳ -> Ԫָ룩ContainerΪunordered_mapunordered_multimap
+    template<typename KeyType, typename MetaType, typename Container>
+    class PropertyMetaMap
+    {
+    public:
+        using key_type = KeyType;
+        using const_iterator = PropertyMetaMapIterator<typename Container::const_iterator, KeyType, MetaType>;
+        using iterator = const_iterator;
+
+        const_iterator begin() const { return const_iterator(m_map.begin()); }
+        const_iterator end() const { return const_iterator(m_map.end()); }
+        size_t size() const { return m_map.size(); }
+        bool empty() const { return m_map.empty(); }
+
+        const_iterator find(const KeyType& key) const
+        {
+            return const_iterator(m_map.find(PropertyMetaKeyRef<KeyType>{ &key }));
+        }
+
+        size_t count(const KeyType& key) const
+        {
+            return m_map.count(PropertyMetaKeyRef<KeyType>{ &key });
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const KeyType& key) const
+        {
+            auto range = m_map.equal_range(PropertyMetaKeyRef<KeyType>{ &key });
+            return { const_iterator(range.first), const_iterator(range.second) };
+        }
+
+        // ԪݣԪƣ
+        void insert(const MetaType* meta)
+        {
+            m_map.emplace(PropertyMetaKeyRef<KeyType>{ &meta->name }, meta);
+        }
+
+        void reserve(size_t count) { m_map.reserve(count); }
+        void clear() { m_map.clear(); }
+
+    private:
+        Container m_map;
+    };
+
+    // 
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        using PropertyMap = PropertyMetaMap<KeyType, PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>,
+        std::unordered_map<PropertyMetaKeyRef<KeyType>, const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*,
+        PropertyMetaKeyRefHash<KeyType, KeyHash>, PropertyMetaKeyRefEqual<KeyType, KeyEqual>>>;
+
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        using PropertyMultiMap = PropertyMetaMap<KeyType, PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>,
+        std::unordered_multimap<PropertyMetaKeyRef<KeyType>, const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*,
+        PropertyMetaKeyRefHash<KeyType, KeyHash>, PropertyMetaKeyRefEqual<KeyType, KeyEqual>>>;
+
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        using PropertyList = PropertyMetaList<PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
+
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        using PropertySet = std::unordered_set<
+        PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>,
+        PropertyMetaHash<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
+
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        using ClassNameList = std::vector<StringType>;
+
+    // PropertyDataϵƻлƻJSONƻȣչͷļ״ʹʱֻ֮
+    // ƻPropertyDataͬʱͷţڵĶ̬жʱһͷţPropertyDataַȫֱС
+    // Ҳ߳ͬʱ״ιͬһƻʱԹһݣֻȷһ
+    class PropertyPlanStorage
+    {
+    public:
+        PropertyPlanStorage() = default;
+        PropertyPlanStorage(const PropertyPlanStorage&) = delete;
+        PropertyPlanStorage& operator=(const PropertyPlanStorage&) = delete;
+
+        ~PropertyPlanStorage()
+        {
+            Node* node = m_head.load(std::memory_order_acquire);
+            while (node)
+            {
+                Node* next = node->next;
+                node->destroy(node->plan);
+                delete node;
+                node = next;
+            }
+        }
+
+        // ȡPlan͵ļƻʱarg죨Plan(arg)׳쳣ʱκݣ
+        template<typename Plan, typename Arg>
+        const Plan& GetOrCreate(const Arg& arg) const
+        {
+            const void* key = &PlanKey<Plan>::value;
+            Node* head = m_head.load(std::memory_order_acquire);
+            if (const void* plan = Find(head, nullptr, key))
+                return *static_cast<const Plan*>(plan);
+
+            std::unique_ptr<Plan> plan(new Plan(arg));
+            Node* node = new Node{ key, plan.get(), &Destroy<Plan>, head };
+            Node* scanned = head;
+            while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                // ߳ȷ½ڵ㣺ֻĲ
+                if (const void* existing = Find(node->next, scanned, key))
+                {
+                    delete node;
+                    return *static_cast<const Plan*>(existing);
+                }
+                scanned = node->next;
+            }
+            return *plan.release();
+        }
+
+    private:
+        struct Node
+        {
+            const void* key;
+            void* plan;
+            void (*destroy)(void* plan);
+            Node* next;
+        };
+
+        // ÿּƻһȡ̬Աĵַ
+        template<typename Plan>
+        struct PlanKey
+        {
+            static constexpr char value = 0;
+        };
+
+        template<typename Plan>
+        static void Destroy(void* plan)
+        {
+            delete static_cast<Plan*>(plan);
+        }
+
+        static const void* Find(const Node* node, const Node* end, const void* key)
+        {
+            for (; node != end; node = node->next)
+            {
+                if (node->key == key)
+                    return node->plan;
+            }
+            return nullptr;
+        }
+
+        mutable std::atomic<Node*> m_head{ nullptr };
+    };
+
+    // ݽṹ - о̬ݽṹϲ
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        struct PropertyData
+    {
+        // Ԫݴ洢ԪݵΨһ洢λãע˳ţ
+        // ָֻ洢ָ룬FINALIZE_PROPERTY_SYSTEM֮޸
+        std::vector<PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> propertyArena;
+
+        // עڼ -> 洢±꣨ͬظעѡ/ʼɺ
+        std::unordered_map<KeyType, size_t, KeyHash, KeyEqual> registrationIndex;
+
+        // 
+        StringType className;
+
+        // ֱӸݣɳʼ˺ֱֻãƸ༰ݣ
+        const PropertyData* parentData = nullptr;
+
+        // ӳ
+        PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> directPropertyMap;       // ֱӳԣO(1)ң
+
+        // ӳ -> ָødirectPropertyMapָ룬ıƣFINALIZE_PROPERTY_SYSTEMʱظһΣ
+        std::unordered_map<StringType,
+            const PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> parentPropertyMaps;
+
+        // Զӳͬԣ
+        PropertyMultiMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allPropertiesMultiMap;
+
+        // б
+        PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> ownPropertiesList;      // бע˳
+        PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allPropertiesList;      // б̳еģͬ
+
+        // б̳˳ֱӸǰԶں
+        ClassNameList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> allParentsName;
+
+        // ѡбӳ䣨ѡԣ -> ѡбѡͨparentDataʣ
+        std::unordered_map<KeyType, std::vector<StringType>, KeyHash, KeyEqual> optionalPropertyMap;
+
+        // IDIDԶȵǰںÿڰע˳
+        std::vector<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> propertyIdTable;
+
+        //  -> IDͬȡ࣬ȣ֧칹ң
+        PropertyNameIndex<KeyType, KeyHash, KeyEqual> propertyNameIndex;
+
+        // ظб̳еģallPropertiesList˳ȡ״γֵƣ
+        std::vector<KeyType> uniquePropertyNames;
+
+        // ע
+        size_t registrationCounter = 0;
+
+        // ʼ־
+        bool initialized = false;
+
+        // ๹л/JSONȼƻPropertyPlanStorage
+        PropertyPlanStorage planStorage;
+
+        // ظָࣩࣨݣҲʱnullptr
+        const PropertyData* FindClassData(const StringType& name) const
+        {
+            for (const PropertyData* data = this; data; data = data->parentData)
+            {
+                if (data->className == name)
+                    return data;
+            }
+            return nullptr;
+        }
+    };
+
+    // ѡ̳࣬Propertyṩѡع
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class OptionalProperty : public Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>
+    {
+    public:
+        using BasePropertyType = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+
+        // ĬϹ캯 - ЧĿѡ
+        OptionalProperty() : BasePropertyType()
+        {
+        }
+
+        OptionalProperty(const BasePropertyType& prop)
+            : BasePropertyType(prop)
+        {
+            // PropertyDataлȡѡб
+            InitializeOptionList();
+        }
+
+        OptionalProperty(const OptionalProperty& other)
+            : BasePropertyType(other), m_optionList(other.m_optionList)
+        {
+        }
+
+        OptionalProperty& operator=(const OptionalProperty& other)
+        {
+            if (this != &other)
+            {
+                BasePropertyType::operator=(other);
+                m_optionList = other.m_optionList;
+            }
+            return *this;
+        }
+
+        // ȡǰѡַ
+        StringType GetOptionString() const
+        {
+            if (!this->IsValid())
+                return StringType{};
+
+            // עͶȡѡֵѡԿöͣ
+            int currentValue = ReadOptionIndex();
+
+            // ڵǰѡбв
+            auto classOptions = GetOptionListForThisClass();
+            if (currentValue >= 0 && currentValue < static_cast<int>(classOptions.size()))
+            {
+                return classOptions[currentValue];
+            }
+
+            // ûҵѡбв
+            if (currentValue >= 0 && currentValue < static_cast<int>(m_optionList.size()))
+            {
+                return m_optionList[currentValue];
+            }
+
+            return StringType{};
+        }
+
+        // ȡѡбǰ+иࣩ
+        const std::vector<StringType>& GetOptionList() const
+        {
+            return m_optionList;
+        }
+
+        // ַͨѡ
+        bool SetOptionByString(const StringType& optionStr)
+        {
+            if (!this->IsValid())
+                return false;
+
+            // ڵǰѡбв
+            auto classOptions = GetOptionListForThisClass();
+            for (size_t i = 0; i < classOptions.size(); ++i)
+            {
+                if (classOptions[i] == optionStr)
+                {
+                    // ҵӦͨsetterֵ
+                    WriteOptionIndex(static_cast<int>(i));
+                    return true;
+                }
+            }
+
+            // ûҵѡбв
+            for (size_t i = 0; i < m_optionList.size(); ++i)
+            {
+                if (m_optionList[i] == optionStr)
+                {
+                    // ҵӦͨsetterֵ
+                    WriteOptionIndex(static_cast<int>(i));
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // ͨѡ
+        bool SetOptionByIndex(int index)
+        {
+            if (!this->IsValid())
+                return false;
+
+            auto classOptions = GetOptionListForThisClass();
+            if (index >= 0 && index < static_cast<int>(classOptions.size()))
+            {
+                WriteOptionIndex(index);
+                return true;
+            }
+
+            if (index >= 0 && index < static_cast<int>(m_optionList.size()))
+            {
+                WriteOptionIndex(index);
+                return true;
+            }
+
+            return false;
+        }
+
+        // Ƿѡ
+        bool IsOptional() const
+        {
+            if (!this->IsValid())
+                return false;
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
+            return meta && meta->isOptional;
+        }
+
+        // ȡѡ
+        size_t GetOptionCount() const
+        {
+            return m_optionList.size();
+        }
+
+    private:
+        // עͶȡǰѡ
+        int ReadOptionIndex() const
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
+            if (!meta || !meta->readOptionIndex)
+                return -1;
+            return meta->readOptionIndex(this->GetObject()->GetPropertyPointer(meta));
+        }
+
+        // עдѡԱֱдֶΣԶԹʱֵ󽻸setter
+        void WriteOptionIndex(int index)
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
+            if (!meta || !meta->constructOptionValue)
+                return;
+
+            auto* obj = this->GetObject();
+            if (!meta->isCustomAccessor)
+            {
+                meta->constructOptionValue(obj->GetPropertyPointer(meta), index);
+                return;
+            }
+
+            alignas(long long) unsigned char storage[sizeof(long long)];
+            meta->constructOptionValue(storage, index);
+            meta->setter(obj, storage);
+        }
+
+        // ȡǰѡбPropertyDataвң
+        std::vector<StringType> GetOptionListForThisClass() const
+        {
+            if (!this->IsValid())
+                return {};
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
+            if (!meta || !meta->isOptional)
+                return {};
+
+            auto* obj = this->GetObject();
+            if (!obj)
+                return {};
+
+            // ͨPropertyDataȡѡб
+            auto* classData = obj->GetPropertyData().FindClassData(meta->className);
+            if (classData)
+            {
+                auto propIt = classData->optionalPropertyMap.find(meta->name);
+                if (propIt != classData->optionalPropertyMap.end())
+                {
+                    return propIt->second;
+                }
+            }
+
+            return {};
+        }
+
+        // ʼѡбϲǰиѡ
+        void InitializeOptionList()
+        {
+            m_optionList.clear();
+
+            if (!this->IsValid())
+                return;
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
+            if (!meta || !meta->isOptional)
+                return;
+
+            auto* obj = this->GetObject();
+            if (!obj)
+                return;
+
+            // Ȼȡǰѡб
+            auto currentClassOptions = GetOptionListForThisClass();
+            for (const auto& option : currentClassOptions)
+            {
+                m_optionList.push_back(option);
+            }
+
+            // ǰЧҪȡͬԵѡб
+            // ظֱӸǰԶں󣩲ͬ
+            for (auto* parentData = obj->GetPropertyData().parentData; parentData; parentData = parentData->parentData)
+            {
+                auto parentPropIt = parentData->optionalPropertyMap.find(meta->name);
+                if (parentPropIt == parentData->optionalPropertyMap.end())
+                    continue;
+
+                // ӸѡҪظ
+                for (const auto& parentOption : parentPropIt->second)
+                {
+                    // ǷѴͬѡ
+                    bool exists = false;
+                    for (const auto& existingOption : m_optionList)
+                    {
+                        if (existingOption == parentOption)
+                        {
+                            exists = true;
+                            break;
+                        }
+                    }
+
+                    if (!exists)
+                    {
+                        m_optionList.push_back(parentOption);
+                    }
+                }
+            }
+        }
+
+    private:
+        std::vector<StringType> m_optionList; // ĺϲѡб
+    };
+
+    // ǿԾʱУһ֮ͣGet/SetֱӷֶΣԱԣ÷Զԣ
+    // ע⣺Get/SetЧԼ飬ʹǰȷIsValid()
+    template<typename T, typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class TypedProperty
+    {
+    public:
+        using ValueType = T;
+
+        // ĬϹ캯 - Чǿ
+        TypedProperty() : m_fieldPtr(nullptr), m_metaPtr(nullptr), m_objPtr(nullptr)
+        {
+        }
+
+        TypedProperty(const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* metaPtr,
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* objPtr)
+            : m_fieldPtr(nullptr), m_metaPtr(metaPtr), m_objPtr(objPtr)
+        {
+            // Աֱӻֶεַ
+            if (m_metaPtr && m_objPtr && !m_metaPtr->isCustomAccessor)
+            {
+                m_fieldPtr = reinterpret_cast<T*>(reinterpret_cast<char*>(m_objPtr) + m_metaPtr->fieldOffset);
+            }
+        }
+
+        // жǷЧ
+        bool IsValid() const
+        {
+            return m_metaPtr != nullptr && m_objPtr != nullptr;
+        }
+
+        // ȡֵ
+        T Get() const
+        {
+            if (m_fieldPtr)
+                return *m_fieldPtr;
+            return *static_cast<T*>(m_metaPtr->getter(m_objPtr));
+        }
+
+        // ֵ
+        void Set(const T& value)
+        {
+            if (m_fieldPtr)
+            {
+                *m_fieldPtr = value;
+                return;
+            }
+            T temp = value;
+            m_metaPtr->setter(m_objPtr, &temp);
+        }
+
+        // ֵֵ汾ֵƶУ
+        void Set(T&& value)
+        {
+            if (m_fieldPtr)
+            {
+                *m_fieldPtr = std::move(value);
+                return;
+            }
+            m_metaPtr->setter(m_objPtr, &value);
+        }
+
+        // ȡֵָ루Զͨgetterȡ
+        T* GetPointer() const
+        {
+            if (m_fieldPtr)
+                return m_fieldPtr;
+            return static_cast<T*>(m_metaPtr->getter(m_objPtr));
+        }
+
+        // ȡֵĳ
+        const T& GetConstReference() const
+        {
+            return *GetPointer();
+        }
+
+        // ȡַԵֻͼTΪstd::basic_string
+        auto GetStringView() const
+        {
+            return std::basic_string_view<typename T::value_type, typename T::traits_type>(*GetPointer());
+        }
+
+        // ȡԵֻͼTṩdata()size()
+        template<typename Container = T>
+        PropertySpan<const typename Container::value_type> GetSpan() const
+        {
+            const Container& container = *GetPointer();
+            return PropertySpan<const typename Container::value_type>(container.data(), container.size());
+        }
+
+        // ǷΪֱֶηʣԱԣ
+        bool IsDirectAccess() const
+        {
+            return m_fieldPtr != nullptr;
+        }
+
+        // ȡö
+        EnumType GetType() const
+        {
+            return m_metaPtr ? m_metaPtr->enumType : EnumType{};
+        }
+
+        // תΪͨõPropertyװ
+        Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> ToProperty() const
+        {
+            if (!IsValid())
+                return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+            return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(m_metaPtr->enumType, m_metaPtr, m_objPtr);
+        }
+
+        // ȡԪ
+        const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetMeta() const
+        {
+            return m_metaPtr;
+        }
+
+        // ȡ
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetObject() const
+        {
+            return m_objPtr;
+        }
+
+    private:
+        T* m_fieldPtr;
+        const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_metaPtr;
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_objPtr;
+    };
+
+    // ༶ԷPropertyDataнһΣڸ༰ʵ
+    // ĳƲ
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class PropertyAccessor
+    {
+    public:
+        // ĬϹ캯 - Чķ
+        PropertyAccessor() : m_metaPtr(nullptr)
+        {
+        }
+
+        explicit PropertyAccessor(const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* metaPtr)
+            : m_metaPtr(metaPtr)
+        {
+        }
+
+        // жϷǷЧ
+        bool IsValid() const
+        {
+            return m_metaPtr != nullptr;
+        }
+
+        // ȡֵָ
+        template<typename T>
+        T Get(const PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj) const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property accessor: cannot get value");
+                throw std::runtime_error("Invalid property accessor: cannot get value");
+            }
+            if (CheckedType && !m_metaPtr->template IsType<T>())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot get value");
+                throw std::runtime_error("Property type mismatch: cannot get value");
+            }
+            if (!m_metaPtr->isCustomAccessor)
+            {
+                return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(&obj) + m_metaPtr->fieldOffset);
+            }
+            return *static_cast<T*>(m_metaPtr->getter(const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(&obj)));
+        }
+
+        // ֵָ
+        template<typename T>
+        void Set(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj, const T& value) const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property accessor: cannot set value");
+                throw std::runtime_error("Invalid property accessor: cannot set value");
+            }
+            if (CheckedType && !m_metaPtr->template IsType<T>())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot set value");
+                throw std::runtime_error("Property type mismatch: cannot set value");
+            }
+            if (!m_metaPtr->isCustomAccessor)
+            {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(&obj) + m_metaPtr->fieldOffset) = value;
+                return;
+            }
+            T temp = value;
+            m_metaPtr->setter(&obj, &temp);
+        }
+
+        // ֵֵָ汾ֵƶУ
+        template<typename T, typename = std::enable_if_t<!std::is_reference_v<T>>>
+        void Set(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj, T&& value) const
+        {
+            if (CheckedAccess && !IsValid())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::InvalidProperty, "Invalid property accessor: cannot set value");
+                throw std::runtime_error("Invalid property accessor: cannot set value");
+            }
+            if (CheckedType && !m_metaPtr->template IsType<T>())
+            {
+                PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot set value");
+                throw std::runtime_error("Property type mismatch: cannot set value");
+            }
+            if (!m_metaPtr->isCustomAccessor)
+            {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(&obj) + m_metaPtr->fieldOffset) = std::move(value);
+                return;
+            }
+            m_metaPtr->setter(&obj, &value);
+        }
+
+        // ȡֵָָ
+        template<typename T>
+        T* GetPointer(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj) const
+        {
+            if (!IsValid())
+                return nullptr;
+            if (PropertyTypeCheckEnabled && !m_metaPtr->template IsType<T>())
+                return nullptr;
+            if (!m_metaPtr->isCustomAccessor)
+            {
+                return reinterpret_cast<T*>(reinterpret_cast<char*>(&obj) + m_metaPtr->fieldOffset);
+            }
+            return static_cast<T*>(m_metaPtr->getter(&obj));
+        }
+
+        // 󶨵ָPropertyװ
+        Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> Bind(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj) const
+        {
+            if (!IsValid())
+                return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+            return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(m_metaPtr->enumType, m_metaPtr, &obj);
+        }
+
+        // Ƿָ󣨶Ϊࣩ
+        bool IsApplicableTo(const PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& obj) const
+        {
+            if (!IsValid())
+                return false;
+            if (obj.GetClassName() == m_metaPtr->className)
+                return true;
+            for (const auto& parentName : obj.GetAllParentsName())
+            {
+                if (parentName == m_metaPtr->className)
+                    return true;
+            }
+            return false;
+        }
+
+        // ǷΪֱֶηʣԱԣ
+        bool IsDirectAccess() const
+        {
+            return IsValid() && !m_metaPtr->isCustomAccessor;
+        }
+
+        // ȡԪ
+        const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetMeta() const
+        {
+            return m_metaPtr;
+        }
+
+    private:
+        // ʲԣPropertyAccessPolicy
+        static constexpr bool CheckedAccess = PropertyAccessPolicy<EnumType>::Checked;
+        static constexpr bool CheckedType = CheckedAccess && PropertyTypeCheckEnabled;
+
+        const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_metaPtr;
+    };
+
+    // ԷʼƻһԤȽΪԪָ룬дʱ˳ֱӷʣԡProperty
+    // ƻԹʱõ༰ʵЧԵԪбֲ䣩
+    template<typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class PropertyAccessPlan
+    {
+    public:
+        // ĬϹ캯 - Чļƻ
+        PropertyAccessPlan() : m_classData(nullptr)
+        {
+        }
+
+        PropertyAccessPlan(const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* classData,
+            std::vector<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> metas)
+            : m_classData(classData), m_metas(std::move(metas))
+        {
+        }
+
+        // жϼƻǷЧ
+        bool IsValid() const
+        {
+            return m_classData != nullptr;
+        }
+
+        // ƻе
+        size_t Size() const
+        {
+            return m_metas.size();
+        }
+
+        // ȡindexԪ
+        const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetMeta(size_t index) const
+        {
+            return m_metas[index];
+        }
+
+        // ȡƻʱ
+        const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* GetClassData() const
+        {
+            return m_classData;
+        }
+
+    private:
+        const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_classData;
+        std::vector<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> m_metas;
+    };
+
+    // ==================== ԷΧPropertyڴ棩 ====================
+
+    // ԵԪʱProperty
+    // BaseIteratorԪбΪԪݣԪӳΪ<, Ԫ>öԣ
+    template<typename BaseIterator, typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class PropertyIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        PropertyIterator() : m_it(), m_objPtr(nullptr)
+        {
+        }
+
+        PropertyIterator(BaseIterator it, PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* objPtr)
+            : m_it(it), m_objPtr(objPtr)
+        {
+        }
+
+        reference operator*() const
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = MetaOf(*m_it);
+            return value_type(meta->enumType, meta, m_objPtr);
+        }
+
+        PropertyIterator& operator++() { ++m_it; return *this; }
+        PropertyIterator operator++(int) { PropertyIterator tmp = *this; ++m_it; return tmp; }
+
+        bool operator==(const PropertyIterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const PropertyIterator& other) const { return m_it != other.m_it; }
+
+    private:
+        static const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* MetaOf(
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& meta)
+        {
+            return &meta;
+        }
+
+        static const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* MetaOf(
+            const std::pair<const KeyType&, const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>&>& pair)
+        {
+            return &pair.second;
+        }
+
+        BaseIterator m_it;
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_objPtr;
+    };
+
+    // ƹ˵Եָֻͬԣֵײб˳
+    // ָָԪݴ洢еƣ˲ߴļ
+    template<typename BaseIterator, typename EnumType, typename KeyType, typename KeyHash, typename KeyEqual,
+        typename KeyToString, typename StringType, typename ErrorCallback>
+        class PropertyNameFilterIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
 
-            return {};
+        PropertyNameFilterIterator() : m_it(), m_end(), m_name(nullptr), m_objPtr(nullptr)
+        {
         }
 
-        // ʼѡбϲǰиѡ
-        void InitializeOptionList()
+        PropertyNameFilterIterator(BaseIterator it, BaseIterator end, const KeyType* name,
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* objPtr)
+            : m_it(it), m_end(end), m_name(name), m_objPtr(objPtr)
         {
-            m_optionList.clear();
+            SkipMismatched();
+        }
 
-            if (!this->IsValid())
-                return;
+        reference operator*() const
+        {
+            return value_type(m_it->enumType, &*m_it, m_objPtr);
+        }
 
-            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
-                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this->GetMetaPtr());
-            if (!meta || !meta->isOptional)
-                return;
+        PropertyNameFilterIterator& operator++() { ++m_it; SkipMismatched(); return *this; }
+        PropertyNameFilterIterator operator++(int) { PropertyNameFilterIterator tmp = *this; ++*this; return tmp; }
 
-            auto* obj = this->GetObject();
-            if (!obj)
-                return;
+        bool operator==(const PropertyNameFilterIterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const PropertyNameFilterIterator& other) const { return m_it != other.m_it; }
 
-            // Ȼȡǰѡб
-            auto currentClassOptions = GetOptionListForThisClass();
-            for (const auto& option : currentClassOptions)
+    private:
+        void SkipMismatched()
+        {
+            KeyEqual equal;
+            while (m_it != m_end && !equal(m_it->name, *m_name))
             {
-                m_optionList.push_back(option);
+                ++m_it;
             }
+        }
 
-            // ǰЧҪȡͬԵѡб
-            // ȡи
-            const auto& parentNames = obj->GetAllParentsName();
-
-            // ÿ࣬ͬ
-            for (const auto& parentClassName : parentNames)
-            {
-                // PropertyDataвҸѡб
-                auto& propertyData = obj->GetPropertyData();
-                auto parentClassIt = propertyData.optionalPropertyMap.find(parentClassName);
-                if (parentClassIt == propertyData.optionalPropertyMap.end())
-                    continue;
-
-                auto parentPropIt = parentClassIt->second.find(meta->name);
-                if (parentPropIt == parentClassIt->second.end())
-                    continue;
+        BaseIterator m_it;
+        BaseIterator m_end;
+        const KeyType* m_name;
+        PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* m_objPtr;
+    };
 
-                // ӸѡҪظ
-                for (const auto& parentOption : parentPropIt->second)
-                {
-                    // ǷѴͬѡ
-                    bool exists = false;
-                    for (const auto& existingOption : m_optionList)
-                    {
-                        if (existingOption == parentOption)
-                        {
-                            exists = true;
-                            break;
-                        }
-                    }
+    // ԷΧһԵֱڷΧforѭ
+    template<typename Iterator>
+    class PropertyRange
+    {
+    public:
+        using iterator = Iterator;
+        using const_iterator = Iterator;
 
-                    if (!exists)
-                    {
-                        m_optionList.push_back(parentOption);
-                    }
-                }
-            }
+        PropertyRange(Iterator first, Iterator last) : m_begin(first), m_end(last)
+        {
         }
 
+        Iterator begin() const { return m_begin; }
+        Iterator end() const { return m_end; }
+        bool empty() const { return m_begin == m_end; }
+
     private:
-        std::vector<StringType> m_optionList; // ĺϲѡб
+        Iterator m_begin;
+        Iterator m_end;
     };
 
     // ==================== ߼ȡ -  ====================
@@ -586,48 +2173,12 @@ namespace ROP
         class PropertySystemUtils
     {
     public:
-        // עḸԵӳ
+        // ݣɳʼҲ޸ģָֻ룬Ƹ༰ݣ
         template<typename ParentClass>
         static void RegisterParentProperties(
-            PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData,
-            const StringType& parentClassName)
+            PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
         {
-            auto& parentPropertyData = ParentClass::GetPropertyDataStatic();
-
-            // Ƹ
-            PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> parentCopy;
-            for (const auto& pair : parentPropertyData.ownPropertyMap)
-            {
-                parentCopy[pair.first] = pair.second;
-            }
-            propertyData.parentPropertyMaps[parentClassName] = parentCopy;
-
-            // 游
-            propertyData.parentOrderedPropertyNames[parentClassName] = parentPropertyData.orderedPropertyNames;
-
-            // ݹע
-            for (const auto& parentPair : parentPropertyData.parentPropertyMaps)
-            {
-                propertyData.parentPropertyMaps[parentPair.first] = parentPair.second;
-            }
-
-            // ݹע
-            for (const auto& parentPair : parentPropertyData.parentOrderedPropertyNames)
-            {
-                propertyData.parentOrderedPropertyNames[parentPair.first] = parentPair.second;
-            }
-
-            // ݹעѡ
-            for (const auto& parentPair : parentPropertyData.optionalPropertyMap)
-            {
-                propertyData.optionalPropertyMap[parentPair.first] = parentPair.second;
-            }
-
-            // ݹע
-            for (const auto& parentPair : parentPropertyData.descriptionMap)
-            {
-                propertyData.descriptionMap[parentPair.first] = parentPair.second;
-            }
+            propertyData.parentData = &ParentClass::GetPropertyDataStatic();
         }
 
         // иб
@@ -652,111 +2203,109 @@ namespace ROP
             }
         }
 
-        // бӳ
-        static void BuildParentPropertiesListMap(
-            PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
-        {
-            propertyData.parentPropertiesListMap.clear();
-
-            // Ӹӳ乹б
-            for (const auto& classPair : propertyData.parentPropertyMaps)
-            {
-                const StringType& className = classPair.first;
-                const auto& propertyMap = classPair.second;
-                auto orderedIt = propertyData.parentOrderedPropertyNames.find(className);
-
-                if (orderedIt != propertyData.parentOrderedPropertyNames.end())
-                {
-                    // ע˳򹹽б
-                    PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> orderedList;
-                    for (const auto& propName : orderedIt->second)
-                    {
-                        auto propIt = propertyMap.find(propName);
-                        if (propIt != propertyMap.end())
-                        {
-                            orderedList.push_back(propIt->second);
-                        }
-                    }
-                    propertyData.parentPropertiesListMap[className] = orderedList;
-                }
-            }
-        }
-
         // бࣩ - ͬԣ࣬ÿ
         static void BuildAllPropertiesList(
             PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
         {
             propertyData.allPropertiesList.clear();
             propertyData.allPropertiesMultiMap.clear();
-
-            // ȡиƣ̳˳ֱӸǰԶں
-            auto& allParentsName = propertyData.allParentsName;
+            propertyData.parentPropertyMaps.clear();
+            propertyData.allPropertiesList.reserve(propertyData.propertyIdTable.size());
+            propertyData.allPropertiesMultiMap.reserve(propertyData.propertyIdTable.size());
 
             // һԼԣע˳
             for (const auto& prop : propertyData.ownPropertiesList)
             {
-                propertyData.allPropertiesList.push_back(prop);
-                propertyData.allPropertiesMultiMap.insert({ prop.name, prop });
+                propertyData.allPropertiesList.push_back(&prop);
             }
 
-            // ڶȻ󰴼̳˳ӸԣֱӸൽԶȣ
-            for (const auto& parentClassName : allParentsName)
+            // ڶȻظӸԣֱӸൽԶȣͬʱӳ
+            for (auto* parentData = propertyData.parentData; parentData; parentData = parentData->parentData)
             {
-                auto it = propertyData.parentPropertiesListMap.find(parentClassName);
-                if (it != propertyData.parentPropertiesListMap.end())
+                for (const auto& prop : parentData->ownPropertiesList)
                 {
-                    for (const auto& prop : it->second)
-                    {
-                        propertyData.allPropertiesList.push_back(prop);
-                        propertyData.allPropertiesMultiMap.insert({ prop.name, prop });
-                    }
+                    propertyData.allPropertiesList.push_back(&prop);
+                }
+                propertyData.parentPropertyMaps[parentData->className] = &parentData->directPropertyMap;
+            }
+
+            // ӳͬequal_rangeе˳ʵ־ҪʱʹGetPropertiesByNameOrdered
+            for (const auto* meta : propertyData.allPropertiesList.Pointers())
+            {
+                propertyData.allPropertiesMultiMap.insert(meta);
+            }
+
+            // ظбÿƶӦΨһIDݴжǷ״γ֣
+            propertyData.uniquePropertyNames.clear();
+            propertyData.uniquePropertyNames.reserve(propertyData.propertyNameIndex.Size());
+            for (const auto& meta : propertyData.allPropertiesList)
+            {
+                if (propertyData.propertyNameIndex.Find(meta.name) == meta.propertyId)
+                {
+                    propertyData.uniquePropertyNames.push_back(meta.name);
                 }
             }
         }
 
-        // ʼݣϲ裩
-        static void InitializePropertyData(
+        // ΪԷIDInitializePropertyData֮ǰãע˳ţ
+        template<typename ParentClass>
+        static void AssignPropertyIds(
             PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
         {
-            // ʼֱӳ
-            propertyData.directPropertyMap.clear();
-            for (const auto& propPair : propertyData.ownPropertyMap)
+            PropertyId nextId = 0;
+            if constexpr (!std::is_same_v<ParentClass, PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>)
+            {
+                nextId = static_cast<PropertyId>(ParentClass::GetPropertyDataStatic().propertyIdTable.size());
+            }
+
+            for (auto& meta : propertyData.propertyArena)
             {
-                propertyData.directPropertyMap[propPair.first] = propPair.second;
+                meta.propertyId = nextId++;
             }
+        }
 
-            // ϲԵԱֻͬһࣩ
-            propertyData.combinedPropertyMap.clear();
+        // ID->IDӳ䣨IDΪǰ׺Ȼ׷ԣ
+        template<typename ParentClass>
+        static void BuildPropertyIdTable(
+            PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
+        {
+            propertyData.propertyIdTable.clear();
+            propertyData.propertyNameIndex.Clear();
 
-            // и
-            for (const auto& classPair : propertyData.parentPropertyMaps)
+            if constexpr (!std::is_same_v<ParentClass, PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>)
             {
-                for (const auto& propPair : classPair.second)
-                {
-                    // ûԣͬ
-                    if (propertyData.combinedPropertyMap.find(propPair.first) == propertyData.combinedPropertyMap.end())
-                    {
-                        propertyData.combinedPropertyMap[propPair.first] = propPair.second;
-                    }
-                }
+                propertyData.propertyIdTable = ParentClass::GetPropertyDataStatic().propertyIdTable;
             }
 
-            // ȻԼԣḲǸͬԣ
-            for (const auto& propPair : propertyData.ownPropertyMap)
+            propertyData.propertyIdTable.reserve(propertyData.propertyIdTable.size() + propertyData.propertyArena.size());
+            for (const auto& meta : propertyData.propertyArena)
             {
-                propertyData.combinedPropertyMap[propPair.first] = propPair.second;
+                propertyData.propertyIdTable.push_back(&meta);
             }
 
-            // ע˳ʼб
+            // ID˳򹹽ֵģģͬԸȳֵ
+            propertyData.propertyNameIndex.Build(propertyData.propertyIdTable);
+        }
+
+        // ʼݣԪݴ洢Ե洢˺ٱ仯ָ뱣Ч
+        static void InitializePropertyData(
+            PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData)
+        {
+            propertyData.directPropertyMap.clear();
             propertyData.ownPropertiesList.clear();
-            for (const auto& name : propertyData.orderedPropertyNames)
+            propertyData.propertyArena.shrink_to_fit();
+            propertyData.directPropertyMap.reserve(propertyData.propertyArena.size());
+            propertyData.ownPropertiesList.reserve(propertyData.propertyArena.size());
+
+            // 洢ע˳
+            for (const auto& meta : propertyData.propertyArena)
             {
-                auto it = propertyData.ownPropertyMap.find(name);
-                if (it != propertyData.ownPropertyMap.end())
-                {
-                    propertyData.ownPropertiesList.push_back(it->second);
-                }
+                propertyData.directPropertyMap.insert(&meta);
+                propertyData.ownPropertiesList.push_back(&meta);
             }
+
+            // ע׶εҪ
+            std::unordered_map<KeyType, size_t, KeyHash, KeyEqual>().swap(propertyData.registrationIndex);
         }
     };
 
@@ -771,6 +2320,7 @@ namespace ROP
         class PropertyObject
     {
         friend class Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        friend class OptionalProperty<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
     public:
         using ROPEnumClass = EnumType;
         using ROPKeyType = KeyType;
@@ -779,10 +2329,22 @@ namespace ROP
         using ROPKeyToString = KeyToString;
         using ROPStringType = StringType;
         using ROPErrorCallback = ErrorCallback;
+        using ROPErrorReporter = PropertyErrorReporter<StringType, ErrorCallback>;
         using ROPPropertyDataType = PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using ROPPropertyMeta = PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
         using ROPObjectType = PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
         using ROPProperty = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
         using ROPOptionalProperty = OptionalProperty<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        template<typename T>
+        using ROPTypedProperty = TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using ROPPropertyAccessor = PropertyAccessor<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using ROPAccessPlan = PropertyAccessPlan<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>;
+        using ROPPropertyListRange = PropertyRange<PropertyIterator<typename PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>::const_iterator,
+            EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
+        using ROPPropertyMultiMapRange = PropertyRange<PropertyIterator<typename PropertyMultiMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>::const_iterator,
+            EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
+        using ROPPropertyNameRange = PropertyRange<PropertyNameFilterIterator<typename PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>::const_iterator,
+            EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>;
 
         virtual ~PropertyObject() = default;
 
@@ -797,89 +2359,364 @@ namespace ROP
         // ̬
         static void ReportError(const StringType& errorMsg)
         {
-            static ROPErrorCallback s_errorCallback = ROPErrorCallback();
-            s_errorCallback(errorMsg);
+            ROPErrorReporter::Report(PropertyErrorKind::Other, errorMsg);
+        }
+
+        // ౨ϢΪַرմʱϢ
+        static void ReportError(PropertyErrorKind kind, const char* errorMsg)
+        {
+            ROPErrorReporter::Report(kind, errorMsg);
+        }
+
+        // ౨ϢmakeMessageɣ
+        template<typename MessageFactory, typename = std::enable_if_t<std::is_invocable_r_v<StringType, MessageFactory&>>>
+        static void ReportError(PropertyErrorKind kind, MessageFactory&& makeMessage)
+        {
+            ROPErrorReporter::Report(kind, std::forward<MessageFactory>(makeMessage));
+        }
+
+        // ôصѡ- ԱбЧô
+        static void SetErrorCallback(const ROPErrorCallback& callback)
+        {
+            ROPErrorReporter::SetCallback(callback);
+        }
+
+        // ûرմرպֻϢҲûص
+        static void SetErrorOutputEnabled(bool enabled)
+        {
+            ROPErrorReporter::SetOutputEnabled(enabled);
+        }
+
+        // ȡָĴ
+        static uint64_t GetErrorCount(PropertyErrorKind kind)
+        {
+            return ROPErrorReporter::GetErrorCount(kind);
+        }
+
+        // ȡĴܴ
+        static uint64_t GetTotalErrorCount()
+        {
+            return ROPErrorReporter::GetTotalErrorCount();
+        }
+
+        // 
+        static void ResetErrorCounts()
+        {
+            ROPErrorReporter::ResetErrorCounts();
+        }
+
+        // Ա - ͨGetPropertyData()ͳһ
+
+        // ȡб
+        const ClassNameList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllParentsName() const
+        {
+            return GetPropertyData().allParentsName;
+        }
+
+        // ȡԣ̳еģ
+        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetOwnPropertiesList() const
+        {
+            return GetPropertyData().ownPropertiesList;
+        }
+
+        // ȡԣ̳еģͬԣ
+        const PropertyMultiMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllPropertiesMultiMap() const
+        {
+            return GetPropertyData().allPropertiesMultiMap;
+        }
+
+        // ȡӳ -> ָøֱӳָ룬ʼʱƸı
+        const std::unordered_map<StringType,
+            const PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>& GetParentPropertiesMap() const
+        {
+            return GetPropertyData().parentPropertyMaps;
+        }
+
+        // ȡֱӳ䣨ԣO(1)ң
+        const PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetDirectPropertyMap() const
+        {
+            return GetPropertyData().directPropertyMap;
+        }
+
+        // ȡָб
+        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetParentPropertiesList(const StringType& parentClassName) const
+        {
+            auto* parentData = GetPropertyData().parentData;
+            auto* classData = parentData ? parentData->FindClassData(parentClassName) : nullptr;
+            if (classData)
+            {
+                return classData->ownPropertiesList;
+            }
+            static PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> emptyList;
+            return emptyList;
+        }
+
+        // ȡб̳еģͬ
+        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllPropertiesList() const
+        {
+            return GetPropertyData().allPropertiesList;
+        }
+
+        // ָаƲԪ - жͬԣصһģ
+        // LookupKeyKeyType߶std::basic_stringʹbasic_string_view/const CharT*
+        template<typename LookupKey>
+        static const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* FindPropertyMeta(
+            const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData, const LookupKey& name)
+        {
+            PropertyId id = FindPropertyId(propertyData, name);
+            return id != InvalidPropertyId ? propertyData.propertyIdTable[id] : nullptr;
+        }
+
+        // ָаƲIDҲʱInvalidPropertyId
+        template<typename LookupKey>
+        static PropertyId FindPropertyId(
+            const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData, const LookupKey& name)
+        {
+            return propertyData.propertyNameIndex.Find(name);
+        }
+
+        // ƲID - һκͨGetPropertyByIdO(1)
+        PropertyId FindPropertyId(const KeyType& name) const
+        {
+            return FindPropertyId(GetPropertyData(), name);
+        }
+
+        // ƲID칹汾KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        PropertyId FindPropertyId(const LookupKey& name) const
+        {
+            return FindPropertyId(GetPropertyData(), name);
+        }
+
+        // ͨIDȡ԰װIDԽʱЧProperty
+        Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetPropertyById(PropertyId id) const
+        {
+            const auto& idTable = GetPropertyData().propertyIdTable;
+            if (id < idTable.size())
+            {
+                const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = idTable[id];
+                return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
+                    meta->enumType, meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
+            }
+            return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+        }
+
+        // ȡIDЧIDΧΪ[0, count)
+        size_t GetPropertyIdCount() const
+        {
+            return GetPropertyData().propertyIdTable.size();
+        }
+
+        // ==================== 쳣Tryϵнӿ ====================
+        // ȱʧͲƥʱֻ״̬룬Ϣôص쳣Ҳڴ
+
+        // ԰ƻȡ԰װҲʱNotFoundҲ޸out
+        PropertyStatus TryGetProperty(const KeyType& name,
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& out) const
+        {
+            return TryGetPropertyByMeta(FindPropertyMeta(GetPropertyData(), name), out);
+        }
+
+        // ԰ƻȡ԰װ칹汾KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        PropertyStatus TryGetProperty(const LookupKey& name,
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& out) const
+        {
+            return TryGetPropertyByMeta(FindPropertyMeta(GetPropertyData(), name), out);
+        }
+
+        // ԰IDȡ԰װIDԽʱNotFound
+        PropertyStatus TryGetPropertyById(PropertyId id,
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& out) const
+        {
+            const auto& idTable = GetPropertyData().propertyIdTable;
+            return TryGetPropertyByMeta(id < idTable.size() ? idTable[id] : nullptr, out);
+        }
+
+        // ԰ƻȡֵɹʱдoutʧʱNotFoundTypeMismatchҲ޸out
+        template<typename T>
+        PropertyStatus TryGetValue(const KeyType& name, T& out) const
+        {
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> prop;
+            PropertyStatus status = TryGetProperty(name, prop);
+            return status == PropertyStatus::Ok ? prop.TryGetValue(out) : status;
+        }
+
+        // ԰ƻȡֵ칹汾KeyType
+        template<typename T, typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        PropertyStatus TryGetValue(const LookupKey& name, T& out) const
+        {
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> prop;
+            PropertyStatus status = TryGetProperty(name, prop);
+            return status == PropertyStatus::Ok ? prop.TryGetValue(out) : status;
+        }
+
+        // ԰ֵʧʱNotFoundTypeMismatchҲ޸
+        // valueתô룬ֵᱻƶУTעȫһ
+        template<typename T>
+        PropertyStatus TrySetValue(const KeyType& name, T&& value)
+        {
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> prop;
+            PropertyStatus status = TryGetProperty(name, prop);
+            return status == PropertyStatus::Ok ? prop.TrySetValue(std::forward<T>(value)) : status;
+        }
+
+        // ԰ֵ칹汾KeyType
+        template<typename LookupKey, typename T, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        PropertyStatus TrySetValue(const LookupKey& name, T&& value)
+        {
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> prop;
+            PropertyStatus status = TryGetProperty(name, prop);
+            return status == PropertyStatus::Ok ? prop.TrySetValue(std::forward<T>(value)) : status;
+        }
+
+        // ==================== д ====================
+
+        // IDбʼƻIDԽʱ׳쳣
+        ROPAccessPlan BuildAccessPlanByIds(const std::vector<PropertyId>& ids) const
+        {
+            const auto& propertyData = GetPropertyData();
+            std::vector<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> metas;
+            metas.reserve(ids.size());
+            for (PropertyId id : ids)
+            {
+                if (id >= propertyData.propertyIdTable.size())
+                {
+                    ReportError(PropertyErrorKind::InvalidProperty, "Invalid property id: cannot build access plan");
+                    throw std::runtime_error("Invalid property id: cannot build access plan");
+                }
+                metas.push_back(propertyData.propertyIdTable[id]);
+            }
+            return ROPAccessPlan(&propertyData, std::move(metas));
+        }
+
+        // бʼƻͬȡģƲʱ׳쳣
+        ROPAccessPlan BuildAccessPlan(const std::vector<KeyType>& names) const
+        {
+            const auto& propertyData = GetPropertyData();
+            std::vector<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*> metas;
+            metas.reserve(names.size());
+            for (const auto& name : names)
+            {
+                const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = FindPropertyMeta(propertyData, name);
+                if (!meta)
+                {
+                    ReportError(PropertyErrorKind::InvalidProperty, "Property not found: cannot build access plan");
+                    throw std::runtime_error("Property not found: cannot build access plan");
+                }
+                metas.push_back(meta);
+            }
+            return ROPAccessPlan(&propertyData, std::move(metas));
         }
 
-        // ôصѡ
-        static void SetErrorCallback(const ROPErrorCallback& callback)
+        // ʼƻȡֵvalues[i]ռƻiԵֵ
+        // Уƻֵͣȫͨſʼȡ
+        void GetValues(const ROPAccessPlan& plan, const PropertyValueRef* values, size_t count) const
         {
-            static ROPErrorCallback s_errorCallback = callback;
-            s_errorCallback = callback;
-        }
+            CheckAccessPlan(plan, values, count);
 
-        // Ա - ͨGetPropertyData()ͳһ
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* self = const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = plan.GetMeta(i);
+                const void* src = meta->isCustomAccessor ? meta->getter(self) : reinterpret_cast<const char*>(this) + meta->fieldOffset;
+                meta->copyAssign(values[i].GetPointer(), src);
+            }
+        }
 
-        // ȡб
-        const ClassNameList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllParentsName() const
+        void GetValues(const ROPAccessPlan& plan, std::initializer_list<PropertyValueRef> values) const
         {
-            return GetPropertyData().allParentsName;
+            GetValues(plan, values.begin(), values.size());
         }
 
-        // ȡԣ̳еģ
-        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetOwnPropertiesList() const
+        // ʼƻֵvalues[i]ƵƻiԣvaluesõĶ󱣳ֲ
+        // Уƻֵͣȫͨſʼд룬Уʧʱ󱣳ֲ
+        void SetValues(const ROPAccessPlan& plan, const PropertyValueRef* values, size_t count)
         {
-            return GetPropertyData().ownPropertiesList;
+            CheckAccessPlan(plan, values, count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = plan.GetMeta(i);
+                if (!meta->isCustomAccessor)
+                {
+                    meta->copyAssign(reinterpret_cast<char*>(this) + meta->fieldOffset, values[i].GetPointer());
+                }
+                else
+                {
+                    // setterܴӴֵƶȸƵʱ
+                    BatchSetterSink sink{ meta, this };
+                    meta->copyInto(values[i].GetPointer(), &BatchSetterSink::Invoke, &sink);
+                }
+            }
         }
 
-        // ȡԣ̳еģͬԣ
-        const PropertyMultiMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllPropertiesMultiMap() const
+        void SetValues(const ROPAccessPlan& plan, std::initializer_list<PropertyValueRef> values)
         {
-            return GetPropertyData().allPropertiesMultiMap;
+            SetValues(plan, values.begin(), values.size());
         }
 
-        // ȡӳ
-        const std::unordered_map<StringType,
-            PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>&GetParentPropertiesMap() const
+        // ʼƻƶֵSetValuesֵͬƶУԶ԰ֱֵӽsetter
+        // úvaluesõĶڱƶ״̬
+        void MoveValues(const ROPAccessPlan& plan, const PropertyValueRef* values, size_t count)
         {
-            return GetPropertyData().parentPropertyMaps;
+            CheckAccessPlan(plan, values, count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = plan.GetMeta(i);
+                if (!meta->isCustomAccessor)
+                {
+                    meta->moveAssign(reinterpret_cast<char*>(this) + meta->fieldOffset, values[i].GetPointer());
+                }
+                else
+                {
+                    meta->setter(this, values[i].GetPointer());
+                }
+            }
         }
 
-        // ȡֱӳ䣨ԣO(1)ң
-        const PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetDirectPropertyMap() const
+        void MoveValues(const ROPAccessPlan& plan, std::initializer_list<PropertyValueRef> values)
         {
-            return GetPropertyData().directPropertyMap;
+            MoveValues(plan, values.begin(), values.size());
         }
 
-        // ȡָб
-        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetParentPropertiesList(const StringType& parentClassName) const
+        // ָн༶ԷҲʱЧ
+        static PropertyAccessor<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> FindPropertyAccessor(
+            const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& propertyData, const KeyType& name)
         {
-            const auto& parentPropertiesListMap = GetPropertyData().parentPropertiesListMap;
-            auto it = parentPropertiesListMap.find(parentClassName);
-            if (it != parentPropertiesListMap.end())
-            {
-                return it->second;
-            }
-            static PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> emptyList;
-            return emptyList;
+            return PropertyAccessor<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(FindPropertyMeta(propertyData, name));
         }
 
-        // ȡб̳еģͬ
-        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetAllPropertiesList() const
+        // ȡ༶Է
+        PropertyAccessor<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetPropertyAccessor(const KeyType& name) const
         {
-            return GetPropertyData().allPropertiesList;
+            return FindPropertyAccessor(GetPropertyData(), name);
         }
 
         // ͨƻȡ԰װ - жͬԣصһģ
         Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetProperty(const KeyType& name) const
         {
-            // ȴֱӳвңO(1)
-            const auto& directMap = GetDirectPropertyMap();
-            auto it = directMap.find(name);
-            if (it != directMap.end())
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = FindPropertyMeta(GetPropertyData(), name);
+            if (meta)
             {
                 return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
-                    it->second.enumType, &it->second, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
+                    meta->enumType, meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
             }
 
-            // ֱӳûҵٴв
-            auto& allProps = GetAllPropertiesMultiMap();
-            auto range = allProps.equal_range(name);
+            // ҲʱЧProperty
+            return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+        }
 
-            if (range.first != range.second)
+        // ͨƻȡ԰װ칹汾string_view/const char*KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetProperty(const LookupKey& name) const
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = FindPropertyMeta(GetPropertyData(), name);
+            if (meta)
             {
                 return Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
-                    range.first->second.enumType, &range.first->second, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
+                    meta->enumType, meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
             }
 
             // ҲʱЧProperty
@@ -908,47 +2745,149 @@ namespace ROP
         // ȡͬԣб
         std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> GetAllPropertiesByName(const KeyType& name) const
         {
-            std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> result;
-            auto& allProps = GetAllPropertiesMultiMap();
-            auto range = allProps.equal_range(name);
-
-            for (auto it = range.first; it != range.second; ++it)
-            {
-                result.push_back(Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
-                    it->second.enumType, &it->second, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this)));
-            }
+            auto range = GetAllPropertiesByNameRange(name);
+            return std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>(range.begin(), range.end());
+        }
 
-            return result;
+        // ȡͬԵķΧ˳ɶӳʱPropertyڴ
+        ROPPropertyMultiMapRange GetAllPropertiesByNameRange(const KeyType& name) const
+        {
+            auto range = GetAllPropertiesMultiMap().equal_range(name);
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* self = const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this);
+            return ROPPropertyMultiMapRange(
+                typename ROPPropertyMultiMapRange::iterator(range.first, self),
+                typename ROPPropertyMultiMapRange::iterator(range.second, self));
         }
 
         // ȡԣ̳еģ˳࣬ÿڰע˳
         std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> GetAllPropertiesOrdered() const
         {
             std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> result;
+            result.reserve(GetAllPropertiesList().size());
+            for (const auto& prop : GetAllPropertiesRange())
+            {
+                result.push_back(prop);
+            }
+            return result;
+        }
+
+        // ȡԵķΧ˳ͬGetAllPropertiesOrderedʱPropertyڴ
+        ROPPropertyListRange GetAllPropertiesRange() const
+        {
             const auto& allPropsList = GetAllPropertiesList();
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* self = const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this);
+            return ROPPropertyListRange(
+                typename ROPPropertyListRange::iterator(allPropsList.begin(), self),
+                typename ROPPropertyListRange::iterator(allPropsList.end(), self));
+        }
+
+    protected:
+        // ʲԣPropertyAccessPolicy
+        static constexpr bool CheckedAccess = PropertyAccessPolicy<EnumType>::Checked;
+        static constexpr bool CheckedType = CheckedAccess && PropertyTypeCheckEnabled;
+
+        // дʱʱԶԵsetterΪcopyIntosink
+        struct BatchSetterSink
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta;
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* obj;
 
-            for (const auto& meta : allPropsList)
+            static void Invoke(void* context, void* value)
             {
-                result.push_back(Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
-                    meta.enumType, &meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this)));
+                BatchSetterSink* sink = static_cast<BatchSetterSink*>(context);
+                sink->meta->setter(sink->obj, value);
             }
+        };
 
-            return result;
+        // ڲУʼƻڱ󣨼ƻõΪֵࣩƻһ
+        void CheckAccessPlan(const ROPAccessPlan& plan, const PropertyValueRef* values, size_t count) const
+        {
+            if constexpr (CheckedAccess)
+            {
+                const PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* classData = &GetPropertyData();
+                while (classData && classData != plan.GetClassData())
+                {
+                    classData = classData->parentData;
+                }
+                if (!plan.IsValid() || !classData)
+                {
+                    ReportError(PropertyErrorKind::InvalidProperty, "Invalid access plan: plan does not apply to this object");
+                    throw std::runtime_error("Invalid access plan: plan does not apply to this object");
+                }
+                if (count != plan.Size())
+                {
+                    ReportError(PropertyErrorKind::InvalidProperty, "Invalid access plan: value count does not match plan size");
+                    throw std::runtime_error("Invalid access plan: value count does not match plan size");
+                }
+            }
+            if constexpr (CheckedType)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (values[i].GetTypeId() != plan.GetMeta(i)->typeId)
+                    {
+                        ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: access plan value");
+                        throw std::runtime_error("Property type mismatch: access plan value");
+                    }
+                }
+            }
+        }
+
+        // ڲԪָ԰װmetaΪʱNotFound
+        PropertyStatus TryGetPropertyByMeta(const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta,
+            Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& out) const
+        {
+            if (!meta)
+                return PropertyStatus::NotFound;
+            out = Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
+                meta->enumType, meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
+            return PropertyStatus::Ok;
+        }
+
+        // ڲͨԪָȡԴ洢ַ
+        // ԱֱӰfieldOffsetַԶԲŵgetter
+        void* GetPropertyPointer(const void* metaPtr) const
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(metaPtr);
+            if (CheckedAccess && !meta)
+            {
+                ReportError(PropertyErrorKind::InvalidMeta, "Invalid property meta pointer");
+                throw std::runtime_error("Invalid property meta pointer");
+            }
+
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* self = const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this);
+            if (!meta->isCustomAccessor)
+            {
+                return reinterpret_cast<char*>(self) + meta->fieldOffset;
+            }
+            return meta->getter(self);
         }
 
-    protected:
         // ڲͨԪָȡֵ
         template<typename T>
         T GetPropertyValue(const void* metaPtr) const
         {
             const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
                 static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(metaPtr);
-            if (!meta)
+            if (CheckedAccess && !meta)
             {
-                ReportError(StringType("Invalid property meta pointer"));
+                ReportError(PropertyErrorKind::InvalidMeta, "Invalid property meta pointer");
                 throw std::runtime_error("Invalid property meta pointer");
             }
 
+            if (CheckedType && !meta->template IsType<T>())
+            {
+                ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot get value");
+                throw std::runtime_error("Property type mismatch: cannot get value");
+            }
+
+            // ·ԱֱӶȡֶΣstd::function
+            if (!meta->isCustomAccessor)
+            {
+                return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(this) + meta->fieldOffset);
+            }
+
             void* ptr = meta->getter(const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this));
             return *reinterpret_cast<T*>(ptr);
         }
@@ -959,28 +2898,69 @@ namespace ROP
         {
             const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
                 static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(metaPtr);
-            if (!meta)
+            if (CheckedAccess && !meta)
             {
-                ReportError(StringType("Invalid property meta pointer"));
+                ReportError(PropertyErrorKind::InvalidMeta, "Invalid property meta pointer");
                 throw std::runtime_error("Invalid property meta pointer");
             }
 
+            if (CheckedType && !meta->template IsType<T>())
+            {
+                ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot set value");
+                throw std::runtime_error("Property type mismatch: cannot set value");
+            }
+
+            // ·ԱֱдֶΣstd::function
+            if (!meta->isCustomAccessor)
+            {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(this) + meta->fieldOffset) = value;
+                return;
+            }
+
             T temp = value;
             meta->setter(const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this), &temp);
         }
 
+        // ڲͨԪֵֵָ汾
+        // ԱֱƶֵԶ԰ѵ÷Ķֱӽsetterʱ
+        template<typename T, typename = std::enable_if_t<!std::is_reference_v<T>>>
+        void SetPropertyValue(const void* metaPtr, T&& value)
+        {
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(metaPtr);
+            if (CheckedAccess && !meta)
+            {
+                ReportError(PropertyErrorKind::InvalidMeta, "Invalid property meta pointer");
+                throw std::runtime_error("Invalid property meta pointer");
+            }
+
+            if (CheckedType && !meta->template IsType<T>())
+            {
+                ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot set value");
+                throw std::runtime_error("Property type mismatch: cannot set value");
+            }
+
+            if (!meta->isCustomAccessor)
+            {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(this) + meta->fieldOffset) = std::move(value);
+                return;
+            }
+
+            meta->setter(this, &value);
+        }
+
     public:
         // ԣԣ̳еģ
         bool HasProperty(const KeyType& name) const
         {
-            // ȼֱӳ䣨O(1)
-            const auto& directMap = GetDirectPropertyMap();
-            if (directMap.find(name) != directMap.end())
-                return true;
+            return FindPropertyId(GetPropertyData(), name) != InvalidPropertyId;
+        }
 
-            // 
-            auto& allProps = GetAllPropertiesMultiMap();
-            return allProps.find(name) != allProps.end();
+        // ԣ칹汾KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        bool HasProperty(const LookupKey& name) const
+        {
+            return FindPropertyId(GetPropertyData(), name) != InvalidPropertyId;
         }
 
         // ضǷָ
@@ -997,41 +2977,66 @@ namespace ROP
             return false;
         }
 
-        // ȡָбע˳
-        PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetParentClassProperties(const StringType& parentClassName) const
+        // ȡָࣩࣨбע˳򣩣ֱӷظڳʼʱб
+        const PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetParentClassProperties(const StringType& parentClassName) const
         {
-            PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> result;
-            auto& allProps = GetAllPropertiesMultiMap();
+            auto* classData = GetPropertyData().FindClassData(parentClassName);
+            if (classData)
+            {
+                return classData->ownPropertiesList;
+            }
+            static PropertyList<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> emptyList;
+            return emptyList;
+        }
 
-            for (const auto& pair : allProps)
+        // ȡָӳֱӷظڳʼʱӳ
+        const PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& GetParentClassPropertyMap(const StringType& parentClassName) const
+        {
+            auto* parentData = GetPropertyData().parentData;
+            auto* classData = parentData ? parentData->FindClassData(parentClassName) : nullptr;
+            if (classData)
             {
-                if (pair.second.className == parentClassName)
-                {
-                    result.push_back(pair.second);
-                }
+                return classData->directPropertyMap;
             }
+            static PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> emptyMap;
+            return emptyMap;
+        }
 
-            // ע˳
-            std::sort(result.begin(), result.end(),
-                [](const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& a,
-                    const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& b)
-                {
-                    return a.registrationOrder < b.registrationOrder;
-                });
+        // ȡǿԾ - ʱУעͣͲƥʱ׳쳣
+        template<typename T>
+        TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetTypedProperty(const KeyType& name) const
+        {
+            return ToTypedProperty<T>(GetProperty(name));
+        }
 
-            return result;
+        // ͨƺȡǿԾ
+        template<typename T>
+        TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetTypedProperty(const KeyType& name, const StringType& className) const
+        {
+            return ToTypedProperty<T>(GetProperty(name, className));
         }
 
-        // ȡָӳ
-        PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetParentClassPropertyMap(const StringType& parentClassName) const
+        // PropertyתΪǿԾ
+        template<typename T>
+        TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> ToTypedProperty(
+            const Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& prop) const
         {
-            auto& parentMaps = GetParentPropertiesMap();
-            auto it = parentMaps.find(parentClassName);
-            if (it != parentMaps.end())
+            // ЧЧTypedProperty
+            if (!prop.IsValid())
             {
-                return it->second;
+                return TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
             }
-            return PropertyMap<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta =
+                static_cast<const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(prop.GetMetaPtr());
+
+            if (!meta->template IsType<T>())
+            {
+                ReportError(PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot create typed property");
+                throw std::runtime_error("Property type mismatch: cannot create typed property");
+            }
+
+            return TypedProperty<T, EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(meta, prop.GetObject());
         }
 
         // PropertyתΪOptionalProperty
@@ -1049,7 +3054,7 @@ namespace ROP
 
             if (!meta || !meta->isOptional)
             {
-                ReportError(StringType("Property is not an optional property"));
+                ReportError(PropertyErrorKind::NotOptional, "Property is not an optional property");
                 throw std::runtime_error("Property is not an optional property");
             }
 
@@ -1067,6 +3072,18 @@ namespace ROP
             return ToOptionalProperty(prop);
         }
 
+        // ͨPropertyȡOptionalProperty칹汾KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        OptionalProperty<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetPropertyAsOptional(const LookupKey& name) const
+        {
+            auto prop = GetProperty(name);
+            if (!prop.IsValid())
+            {
+                return OptionalProperty<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>();
+            }
+            return ToOptionalProperty(prop);
+        }
+
         // ͨƺȡOptionalProperty
         OptionalProperty<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> GetPropertyAsOptional(const KeyType& name, const StringType& className) const
         {
@@ -1085,6 +3102,14 @@ namespace ROP
             return prop.GetDescription();
         }
 
+        // ȡԵ칹汾KeyType
+        template<typename LookupKey, typename = std::enable_if_t<PropertyKeyTraits<KeyType, KeyHash, KeyEqual>::template IsHeterogeneous<LookupKey>>>
+        StringType GetPropertyDescription(const LookupKey& name) const
+        {
+            auto prop = GetProperty(name);
+            return prop.GetDescription();
+        }
+
         // ȡԺذƺַ
         StringType GetPropertyWithDescription(const KeyType& name) const
         {
@@ -1105,20 +3130,29 @@ namespace ROP
         // ȡͬԣ˳࣬ÿڰע˳
         std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> GetPropertiesByNameOrdered(const KeyType& name) const
         {
-            std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>> result;
+            auto range = GetPropertiesByNameOrderedRange(name);
+            return std::vector<Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>>(range.begin(), range.end());
+        }
+
+        // ȡͬԵΧࣩʱPropertyڴ
+        // ƲʱؿշΧ
+        ROPPropertyNameRange GetPropertiesByNameOrderedRange(const KeyType& name) const
+        {
             const auto& allPropsList = GetAllPropertiesList();
+            PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* self = const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this);
 
-            for (const auto& meta : allPropsList)
+            // Ƚ洢еƣʱø
+            const PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* meta = FindPropertyMeta(GetPropertyData(), name);
+            if (!meta)
             {
-                KeyEqual equal;
-                if (equal(meta.name, name))
-                {
-                    result.push_back(Property<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>(
-                        meta.enumType, &meta, const_cast<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(this)));
-                }
+                return ROPPropertyNameRange(
+                    typename ROPPropertyNameRange::iterator(allPropsList.end(), allPropsList.end(), nullptr, self),
+                    typename ROPPropertyNameRange::iterator(allPropsList.end(), allPropsList.end(), nullptr, self));
             }
 
-            return result;
+            return ROPPropertyNameRange(
+                typename ROPPropertyNameRange::iterator(allPropsList.begin(), allPropsList.end(), &meta->name, self),
+                typename ROPPropertyNameRange::iterator(allPropsList.end(), allPropsList.end(), &meta->name, self));
         }
 
         // ȡͬԣ
@@ -1127,20 +3161,24 @@ namespace ROP
             return GetAllPropertiesList().size();
         }
 
-        // ȡظб
-        std::vector<KeyType> GetUniquePropertyNames() const
+        // ȡظб࣬ÿڰע˳
+        const std::vector<KeyType>& GetUniquePropertyNames() const
         {
-            std::unordered_set<KeyType, KeyHash, KeyEqual> uniqueNames;
-            const auto& allPropsList = GetAllPropertiesList();
+            return GetPropertyData().uniquePropertyNames;
+        }
+    };
 
-            for (const auto& meta : allPropsList)
-            {
-                uniqueNames.insert(meta.name);
-            }
+    // жBaseǷΪDerivedķ顢ֻࣺBase* -> Derived*static_castϷ
+    // һӶDerivedеƫǱڳҪָͨʱ
+    template<typename Base, typename Derived, typename = void>
+    struct IsNonVirtualBaseOf : std::false_type
+    {
+    };
 
-            std::vector<KeyType> result(uniqueNames.begin(), uniqueNames.end());
-            return result;
-        }
+    template<typename Base, typename Derived>
+    struct IsNonVirtualBaseOf<Base, Derived, std::void_t<decltype(static_cast<Derived*>(std::declval<Base*>()))>>
+        : std::is_base_of<Base, Derived>
+    {
     };
 
     // עģ֧ࣨʽӿڣ
@@ -1166,6 +3204,15 @@ namespace ROP
             size_t offset = reinterpret_cast<size_t>(
                 &(reinterpret_cast<ClassType*>(0)->*memberPtr));
 
+            // PropertyObjectӶClassTypeеƫƣʹ÷ǿַ̽static_castĿָжϣ
+            // ַ̽ûжֻзתǲڴĳƫƣҪȡָ룬
+            // Եgetter/setterҲӻൽClassTypestatic_castҪPropertyObjectΪ
+            static_assert(IsNonVirtualBaseOf<PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>, ClassType>::value,
+                "PropertyObject must be a non-virtual, unambiguous base of the registered class");
+            const uintptr_t probeAddress = 0x1000;
+            ptrdiff_t baseOffset = reinterpret_cast<const char*>(static_cast<const PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*>(
+                reinterpret_cast<const ClassType*>(probeAddress))) - reinterpret_cast<const char*>(probeAddress);
+
             // getter
             std::function<void* (PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*)> getter =
                 [memberPtr](PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* obj) -> void*
@@ -1174,12 +3221,12 @@ namespace ROP
                 return &(derived->*memberPtr);
             };
 
-            // setter
+            // settervalueָƶʱֱƶֵ
             std::function<void(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*, void*)> setter =
                 [memberPtr](PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* obj, void* value)
             {
                 ClassType* derived = static_cast<ClassType*>(obj);
-                derived->*memberPtr = *static_cast<PropertyType*>(value);
+                derived->*memberPtr = std::move(*static_cast<PropertyType*>(value));
             };
 
             // Ԫ
@@ -1188,7 +3235,13 @@ namespace ROP
             meta.enumType = enumType;
             // ʹתΪStringType
             meta.typeName = StringType(typeid(PropertyType).name());
+            meta.typeId = GetPropertyTypeId<PropertyType>();
+            meta.copyAssign = &PropertyValueOps<PropertyType>::CopyAssign;
+            meta.moveAssign = &PropertyValueOps<PropertyType>::MoveAssign;
+            meta.copyInto = &PropertyValueOps<PropertyType>::CopyInto;
+            PropertyBinaryOps<PropertyType>::AssignTo(meta);
             meta.offset = offset;
+            meta.fieldOffset = static_cast<ptrdiff_t>(offset) - baseOffset;
             meta.className = m_className;
             meta.getter = getter;
             meta.setter = setter;
@@ -1196,17 +3249,8 @@ namespace ROP
             meta.registrationOrder = m_propertyData.registrationCounter++;
             meta.description = description;
 
-            // ¼ע˳
-            m_propertyData.orderedPropertyNames.push_back(name);
-
-            // עᵽ
-            m_propertyData.ownPropertyMap[name] = meta;
-
-            // 洢Ϣ
-            if (!description.empty())
-            {
-                m_propertyData.descriptionMap[m_className][name] = description;
-            }
+            // Ԫݴ洢
+            AddPropertyMeta(std::move(meta));
 
             return *this;
         }
@@ -1242,6 +3286,11 @@ namespace ROP
             meta.name = name;
             meta.enumType = enumType;
             meta.typeName = StringType(typeid(PropertyType).name());
+            meta.typeId = GetPropertyTypeId<PropertyType>();
+            meta.copyAssign = &PropertyValueOps<PropertyType>::CopyAssign;
+            meta.moveAssign = &PropertyValueOps<PropertyType>::MoveAssign;
+            meta.copyInto = &PropertyValueOps<PropertyType>::CopyInto;
+            PropertyBinaryOps<PropertyType>::AssignTo(meta);
             meta.offset = 0; // Զƫ
             meta.className = m_className;
             meta.getter = getter;
@@ -1250,17 +3299,59 @@ namespace ROP
             meta.registrationOrder = m_propertyData.registrationCounter++;
             meta.description = description;
 
-            // ¼ע˳
-            m_propertyData.orderedPropertyNames.push_back(name);
+            // Ԫݴ洢
+            AddPropertyMeta(std::move(meta));
 
-            // עᵽ
-            m_propertyData.ownPropertyMap[name] = meta;
+            return *this;
+        }
 
-            // 洢Ϣ
-            if (!description.empty())
+        // עԣԶgetterͽֵsetter- ʽӿڣ
+        // settervoid SetXxx(PropertyType&&)ʱֵƶsetter
+        template<typename PropertyType>
+        PropertyRegistrar& RegisterProperty(
+            EnumType enumType,
+            const KeyType& name,
+            void (ClassType::* setterFunc)(PropertyType&&),
+            PropertyType& (ClassType::* getterFunc)(),
+            const StringType& description = StringType())
+        {
+            // getter
+            std::function<void* (PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*)> getter =
+                [getterFunc](PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* obj) -> void*
             {
-                m_propertyData.descriptionMap[m_className][name] = description;
-            }
+                ClassType* derived = static_cast<ClassType*>(obj);
+                PropertyType& ref = (derived->*getterFunc)();
+                return &ref;
+            };
+
+            // settervalueָƶʱ
+            std::function<void(PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>*, void*)> setter =
+                [setterFunc](PropertyObject<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>* obj, void* value)
+            {
+                ClassType* derived = static_cast<ClassType*>(obj);
+                (derived->*setterFunc)(std::move(*static_cast<PropertyType*>(value)));
+            };
+
+            // Ԫ
+            PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback> meta;
+            meta.name = name;
+            meta.enumType = enumType;
+            meta.typeName = StringType(typeid(PropertyType).name());
+            meta.typeId = GetPropertyTypeId<PropertyType>();
+            meta.copyAssign = &PropertyValueOps<PropertyType>::CopyAssign;
+            meta.moveAssign = &PropertyValueOps<PropertyType>::MoveAssign;
+            meta.copyInto = &PropertyValueOps<PropertyType>::CopyInto;
+            PropertyBinaryOps<PropertyType>::AssignTo(meta);
+            meta.offset = 0; // Զƫ
+            meta.className = m_className;
+            meta.getter = getter;
+            meta.setter = setter;
+            meta.isCustomAccessor = true;
+            meta.registrationOrder = m_propertyData.registrationCounter++;
+            meta.description = description;
+
+            // Ԫݴ洢
+            AddPropertyMeta(std::move(meta));
 
             return *this;
         }
@@ -1274,6 +3365,8 @@ namespace ROP
             std::initializer_list<const char*> options,
             const StringType& description = StringType())
         {
+            static_assert(std::is_integral_v<PropertyType> || std::is_enum_v<PropertyType>, "Optional property must be an integral or enum type");
+
             // עͨ
             RegisterProperty(enumType, name, memberPtr, description);
 
@@ -1285,11 +3378,13 @@ namespace ROP
             }
 
             // ȻΪѡ
-            auto& meta = m_propertyData.ownPropertyMap[name];
+            auto& meta = m_propertyData.propertyArena[m_propertyData.registrationIndex[name]];
             meta.isOptional = true;
+            meta.readOptionIndex = &PropertyOptionOps<PropertyType>::ReadIndex;
+            meta.constructOptionValue = &PropertyOptionOps<PropertyType>::ConstructFromIndex;
 
             // 洢ѡӳ
-            m_propertyData.optionalPropertyMap[m_className][name] = optionVec;
+            m_propertyData.optionalPropertyMap[name] = optionVec;
 
             // ֤ѡӳֵ0ʼ
             if (!optionVec.empty())
@@ -1300,11 +3395,13 @@ namespace ROP
                 {
                     if (!optionSet.insert(option).second)
                     {
-                        // ʹôص
-                        StringType warningMsg = StringType("Warning: Duplicate option string '") + option +
-                            "' in property '" + KeyToString()(name) +
-                            "' of class '" + m_className + "'";
-                        ErrorCallback()(warningMsg);
+                        // ʹôص棨رմʱϢ
+                        PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::DuplicateOption, [&]()
+                            {
+                                return StringType("Warning: Duplicate option string '") + option +
+                                    "' in property '" + KeyToString()(name) +
+                                    "' of class '" + m_className + "'";
+                            });
                     }
                 }
             }
@@ -1322,6 +3419,8 @@ namespace ROP
             std::initializer_list<const char*> options,
             const StringType& description = StringType())
         {
+            static_assert(std::is_integral_v<PropertyType> || std::is_enum_v<PropertyType>, "Optional property must be an integral or enum type");
+
             // עԶ
             RegisterProperty(enumType, name, setterFunc, getterFunc, description);
 
@@ -1333,11 +3432,13 @@ namespace ROP
             }
 
             // ȻΪѡ
-            auto& meta = m_propertyData.ownPropertyMap[name];
+            auto& meta = m_propertyData.propertyArena[m_propertyData.registrationIndex[name]];
             meta.isOptional = true;
+            meta.readOptionIndex = &PropertyOptionOps<PropertyType>::ReadIndex;
+            meta.constructOptionValue = &PropertyOptionOps<PropertyType>::ConstructFromIndex;
 
             // 洢ѡӳ
-            m_propertyData.optionalPropertyMap[m_className][name] = optionVec;
+            m_propertyData.optionalPropertyMap[name] = optionVec;
 
             // ֤ѡӳֵ0ʼ
             if (!optionVec.empty())
@@ -1347,11 +3448,13 @@ namespace ROP
                 {
                     if (!optionSet.insert(option).second)
                     {
-                        // ʹôص
-                        StringType warningMsg = StringType("Warning: Duplicate option string '") + option +
-                            "' in property '" + KeyToString()(name) +
-                            "' of class '" + m_className + "'";
-                        ErrorCallback()(warningMsg);
+                        // ʹôص棨رմʱϢ
+                        PropertyErrorReporter<StringType, ErrorCallback>::Report(PropertyErrorKind::DuplicateOption, [&]()
+                            {
+                                return StringType("Warning: Duplicate option string '") + option +
+                                    "' in property '" + KeyToString()(name) +
+                                    "' of class '" + m_className + "'";
+                            });
                     }
                 }
             }
@@ -1362,16 +3465,29 @@ namespace ROP
         // עԵ
         PropertyRegistrar& SetDescription(const KeyType& name, const StringType& description)
         {
-            auto it = m_propertyData.ownPropertyMap.find(name);
-            if (it != m_propertyData.ownPropertyMap.end())
+            auto it = m_propertyData.registrationIndex.find(name);
+            if (it != m_propertyData.registrationIndex.end())
             {
-                it->second.description = description;
-                m_propertyData.descriptionMap[m_className][name] = description;
+                m_propertyData.propertyArena[it->second].description = description;
             }
             return *this;
         }
 
     private:
+        // Ԫݴ뱾Ĵ洢ͬظעʱ֮ǰԪݣԭעλã
+        void AddPropertyMeta(PropertyMeta<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>&& meta)
+        {
+            auto result = m_propertyData.registrationIndex.emplace(meta.name, m_propertyData.propertyArena.size());
+            if (result.second)
+            {
+                m_propertyData.propertyArena.push_back(std::move(meta));
+            }
+            else
+            {
+                m_propertyData.propertyArena[result.first->second] = std::move(meta);
+            }
+        }
+
         PropertyData<EnumType, KeyType, KeyHash, KeyEqual, KeyToString, StringType, ErrorCallback>& m_propertyData;
         StringType m_className;
     };
@@ -1387,12 +3503,12 @@ namespace ROP
         if (propertyData.initialized) return true; \
         \
         const ROPStringType classnamestring = ROPStringType(#ClassName); \
+        propertyData.className = classnamestring; \
         \
         /* עḸԵӳ */ \
         if constexpr (!std::is_same_v<ParentClassName, ROP::PropertyObject<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>>) { \
             ParentClassName::StaticInitializeProperties(); \
-            ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::RegisterParentProperties<ParentClassName>( \
-                propertyData, ROPStringType(#ParentClassName)); \
+            ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::RegisterParentProperties<ParentClassName>(propertyData); \
         } \
         \
         ROPStringType ParentClassNameString = ROPStringType(#ParentClassName);
@@ -1403,12 +3519,15 @@ namespace ROP
         ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::BuildAllParentsNameList<ROPParentClassType>( \
             propertyData, ParentClassNameString); \
         \
-        /* бӳ */ \
-        ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::BuildParentPropertiesListMap(propertyData); \
+        /* ΪԷID */ \
+        ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::AssignPropertyIds<ROPParentClassType>(propertyData); \
         \
         /* ʹúϲʼ */ \
         ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::InitializePropertyData(propertyData); \
         \
+        /* ID */ \
+        ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::BuildPropertyIdTable<ROPParentClassType>(propertyData); \
+        \
         /* б࣬ͬ */ \
         ROP::PropertySystemUtils<ROPEnumClass, ROPKeyType, ROPKeyHash, ROPKeyEqual, ROPKeyToString, ROPStringType, ROPErrorCallback>::BuildAllPropertiesList(propertyData); \
         \
@@ -1431,6 +3550,16 @@ public:\
         static ROPPropertyDataType s_propertyData; \
         return s_propertyData; \
     } \
+    /* ȡ༶Էڱ༰ʵ */ \
+    static ROPPropertyAccessor GetClassPropertyAccessor(const ROPKeyType& name) { \
+        StaticInitializeProperties(); \
+        return ROPObjectType::FindPropertyAccessor(GetPropertyDataStatic(), name); \
+    } \
+    /* ȡ༶IDڱ༰оЧ */ \
+    static ROP::PropertyId GetClassPropertyId(const ROPKeyType& name) { \
+        StaticInitializeProperties(); \
+        return ROPObjectType::FindPropertyId(GetPropertyDataStatic(), name); \
+    } \
 protected: \
     using ROPClassType = ClassName;\
     using ROPParentClassType = ParentClassName;\
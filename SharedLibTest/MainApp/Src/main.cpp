@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstdio>
 #include "SharedLibTest/DynamicLoader.h"
 #include "TestCore/CorePropertyType.h"
 #include "Testlib3/Test3Class.h"
@@ -127,6 +128,45 @@ void TestDynamicLibrary(const std::string& libPath, const std::string& libName,
     }
 }
 
+// Test a mapped property store of a dynamically loaded class across a library reload:
+// the store's decoding plan belongs to the class's PropertyData, so after the library is
+// unloaded and loaded again the store must be read with a plan built from the new PropertyData
+void TestMappedStoreReload(const std::string& libPath)
+{
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "Testing Test1lib Mapped Store (Library Reload)" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+
+    const char* storePath = "Test1Store.bin";
+    const int objectCount = 8;
+    const int index = 5;
+
+    for (int round = 0; round < 2; ++round)
+    {
+        SharedLibTest::ScopedLibraryLoader loader(libPath);
+        if (!loader.IsLoaded())
+        {
+            std::cout << "ERROR: Failed to load library" << std::endl;
+            return;
+        }
+
+        auto writeStore = loader.GetLoader()->GetFunction<bool(const char*, int)>("WriteTest1Store");
+        auto readScore = loader.GetLoader()->GetFunction<int(const char*, int)>("ReadTest1StoreScore");
+
+        if (round == 0 && !writeStore(storePath, objectCount))
+        {
+            std::cout << "ERROR: Failed to write store" << std::endl;
+            return;
+        }
+
+        std::cout << (round == 0 ? "\n[After Load]" : "\n[After Reload]") << std::endl;
+        std::cout << "  score[" << index << "] = " << readScore(storePath, index)
+                  << " (expected " << index * 10 << ")" << std::endl;
+    }
+
+    std::remove(storePath);
+}
+
 // Test statically linked library
 void TestStaticLibrary()
 {
@@ -215,6 +255,9 @@ int main(int argc, char* argv[])
                        "CreateTest2Object", "DestroyTest2Object",
                        "GetTest2LibVersion");
 
+    // Test a mapped store after the library is reloaded
+    TestMappedStoreReload("Test1lib.dll");
+
     // Test static linking
     TestStaticLibrary();
 
@@ -225,6 +268,7 @@ int main(int argc, char* argv[])
     std::cout << "  [OK] Object creation via factory functions" << std::endl;
     std::cout << "  [OK] Property discovery and access across DLLs" << std::endl;
     std::cout << "  [OK] Property modification via reflection" << std::endl;
+    std::cout << "  [OK] Mapped store read after library reload" << std::endl;
     std::cout << "\n[STATIC LINKING]" << std::endl;
     std::cout << "  [OK] Direct object creation" << std::endl;
     std::cout << "  [OK] Direct API access" << std::endl;
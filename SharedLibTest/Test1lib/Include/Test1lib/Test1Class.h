@@ -89,6 +89,11 @@ extern "C" {
     TEST1LIB_EXPORT void DestroyTest1Object(Test1Class* obj);
     TEST1LIB_EXPORT const char* GetTest1LibVersion();
     TEST1LIB_EXPORT const char* GetTest1LibDescription();
+
+    // Mapped property store of Test1Class objects (object i has objectId = i and score = i * 10)
+    TEST1LIB_EXPORT bool WriteTest1Store(const char* path, int objectCount);
+    // Returns the score of object index in the store, or -1 if the store cannot be read
+    TEST1LIB_EXPORT int ReadTest1StoreScore(const char* path, int index);
 }
 
 }
@@ -1,5 +1,7 @@
 #include "Test1lib/Test1Class.h"
+#include <ROP/PropertyStore.h>
 #include <iostream>
+#include <vector>
 
 namespace Test1lib
 {
@@ -98,6 +100,42 @@ const char* GetTest1LibDescription()
     return "Test1lib - A test dynamic library implementing Test1Class";
 }
 
+bool WriteTest1Store(const char* path, int objectCount)
+{
+    std::vector<Test1Class> objects(static_cast<size_t>(objectCount));
+    std::vector<Test1Class*> pointers;
+    for (int i = 0; i < objectCount; ++i)
+    {
+        objects[i].SetObjectId(i);
+        objects[i].GetProperty("score").SetValue<int>(i * 10);
+        pointers.push_back(&objects[i]);
+    }
+
+    try
+    {
+        ROP::PropertyMappedStore<Test1Class>::Write(path, pointers);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+int ReadTest1StoreScore(const char* path, int index)
+{
+    try
+    {
+        ROP::PropertyMappedStore<Test1Class> store(path);
+        auto scoreProp = store.GetProperty(static_cast<size_t>(index), "score");
+        return scoreProp.IsValid() ? scoreProp.GetValue<int>() : -1;
+    }
+    catch (const std::exception&)
+    {
+        return -1;
+    }
+}
+
 }
 
 }
@@ -5,7 +5,13 @@
 #include <vector>
 #include <random>
 #include <algorithm>
+#include <array>
 #include <ROP/RunTimeObjectProperty.h>
+#include <ROP/PropertyAlgorithm.h>
+#include <ROP/PropertyParallel.h>
+#include <ROP/PropertySerializer.h>
+#include <ROP/PropertyJson.h>
+#include <ROP/PropertyStore.h>
 
 // 定义属性枚举类型（用于测试）
 enum class TestPropertyType
@@ -1932,38 +1938,39 @@ struct ROP::DefaultErrorCallback<CustomString>
 // ==================== 测试自定义错误回调 ====================
 
 // 错误收集器 - 收集所有错误信息到内存中
+// SetErrorCallback保存的是收集器的副本，副本之间共享同一份错误列表
 class ErrorCollector
 {
 public:
-    mutable std::vector<std::string> collectedErrors;
+    std::shared_ptr<std::vector<std::string>> collectedErrors = std::make_shared<std::vector<std::string>>();
 
     void operator()(const std::string& errorMsg) const
     {
-        collectedErrors.push_back(errorMsg);
+        collectedErrors->push_back(errorMsg);
     }
 
     void Clear()
     {
-        collectedErrors.clear();
+        collectedErrors->clear();
     }
 
     size_t GetErrorCount() const
     {
-        return collectedErrors.size();
+        return collectedErrors->size();
     }
 
     std::string GetLastError() const
     {
-        if (collectedErrors.empty())
+        if (collectedErrors->empty())
         {
             return "";
         }
-        return collectedErrors.back();
+        return collectedErrors->back();
     }
 
     bool HasErrorContaining(const std::string& substring) const
     {
-        for (const auto& err : collectedErrors)
+        for (const auto& err : *collectedErrors)
         {
             if (err.find(substring) != std::string::npos)
             {
@@ -1975,10 +1982,10 @@ public:
 
     void PrintAllErrors() const
     {
-        std::cout << "  收集到的错误信息（共 " << collectedErrors.size() << " 条）:" << std::endl;
-        for (size_t i = 0; i < collectedErrors.size(); ++i)
+        std::cout << "  收集到的错误信息（共 " << collectedErrors->size() << " 条）:" << std::endl;
+        for (size_t i = 0; i < collectedErrors->size(); ++i)
         {
-            std::cout << "    [" << i << "] " << collectedErrors[i] << std::endl;
+            std::cout << "    [" << i << "] " << (*collectedErrors)[i] << std::endl;
         }
     }
 };
@@ -2955,6 +2962,2725 @@ void TestCustomErrorCallback()
 }
 
 
+// ==================== 测试强类型属性句柄 ====================
+
+void TestTypedProperty()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试强类型属性句柄（TypedProperty）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 基本读写
+    {
+        std::cout << "\n测试1: 基本读写" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        obj.intValue1 = 42;
+        obj.baseIntValue = 7;
+        obj.stringValue = "typed";
+
+        auto intProp = obj.GetTypedProperty<int>("intValue1");
+        auto baseIntProp = obj.GetTypedProperty<int>("baseIntValue");
+        auto stringProp = obj.GetTypedProperty<std::string>("stringValue");
+
+        std::cout << "  intValue1: " << intProp.Get() << " (直接访问: " << (intProp.IsDirectAccess() ? "是" : "否") << ")" << std::endl;
+        std::cout << "  baseIntValue: " << baseIntProp.Get() << std::endl;
+        std::cout << "  stringValue: " << stringProp.GetConstReference() << std::endl;
+
+        intProp.Set(100);
+        stringProp.Set("changed");
+        std::cout << "  设置后 intValue1: " << obj.intValue1 << ", stringValue: " << obj.stringValue << std::endl;
+
+        auto missingProp = obj.GetTypedProperty<int>("nonExistentProperty");
+        std::cout << "  不存在属性IsValid(): " << (missingProp.IsValid() ? "true" : "false") << std::endl;
+    }
+
+    // 测试2: 自定义访问器
+    {
+        std::cout << "\n测试2: 自定义访问器" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestCustomAccessorObject obj;
+        auto customIntProp = obj.GetTypedProperty<int>("customInt");
+        std::cout << "  customInt直接访问: " << (customIntProp.IsDirectAccess() ? "是" : "否") << std::endl;
+
+        customIntProp.Set(2000);
+        std::cout << "  设置2000后（setter限制为1000）: " << customIntProp.Get()
+            << ", directIntValue: " << obj.directIntValue << std::endl;
+    }
+
+    // 测试3: 类型不匹配
+    {
+        std::cout << "\n测试3: 类型不匹配" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        try
+        {
+            auto wrongProp = obj.GetTypedProperty<float>("intValue1");
+            std::cout << "  错误: 类型不匹配不应该成功" << std::endl;
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::cout << "  正确捕获异常: " << e.what() << std::endl;
+        }
+    }
+
+    // 测试4: 性能对比
+    {
+        std::cout << "\n测试4: 性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        TestDerivedObject obj;
+
+        auto prop = obj.GetProperty("intValue1");
+        auto start = Clock::now();
+        int sum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            sum += prop.GetValue<int>();
+            prop.SetValue<int>(i % 100);
+        }
+        auto propertyDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        auto typedProp = obj.GetTypedProperty<int>("intValue1");
+        start = Clock::now();
+        int typedSum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            typedSum += typedProp.Get();
+            typedProp.Set(i % 100);
+        }
+        auto typedDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  Property访问: " << propertyDuration.count() / (ITERATIONS * 2.0) << " ns/操作" << std::endl;
+        std::cout << "  TypedProperty访问: " << typedDuration.count() / (ITERATIONS * 2.0) << " ns/操作" << std::endl;
+        std::cout << "  验证和: " << sum << " / " << typedSum << std::endl;
+    }
+}
+
+
+// ==================== 测试类级属性访问器 ====================
+
+void TestClassPropertyAccessor()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试类级属性访问器（PropertyAccessor）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 一次解析，作用于多个实例
+    {
+        std::cout << "\n测试1: 一次解析，作用于多个实例" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        auto intAccessor = TestDerivedObject::GetClassPropertyAccessor("intValue1");
+        auto baseIntAccessor = TestBaseObject::GetClassPropertyAccessor("baseIntValue");
+        auto customAccessor = TestCustomAccessorObject::GetClassPropertyAccessor("customInt");
+
+        TestDerivedObject obj1;
+        TestDerivedObject obj2;
+        intAccessor.Set<int>(obj1, 11);
+        intAccessor.Set<int>(obj2, 22);
+        baseIntAccessor.Set<int>(obj2, 33);
+
+        std::cout << "  obj1.intValue1: " << intAccessor.Get<int>(obj1) << std::endl;
+        std::cout << "  obj2.intValue1: " << intAccessor.Get<int>(obj2) << std::endl;
+        std::cout << "  obj2.baseIntValue（基类访问器作用于子类）: " << obj2.baseIntValue << std::endl;
+
+        TestCustomAccessorObject customObj;
+        customAccessor.Set<int>(customObj, 5000);
+        std::cout << "  customInt（自定义访问器）: " << customAccessor.Get<int>(customObj) << std::endl;
+
+        TestBaseObject baseObj;
+        std::cout << "  intValue1访问器适用于TestDerivedObject: " << (intAccessor.IsApplicableTo(obj1) ? "是" : "否") << std::endl;
+        std::cout << "  intValue1访问器适用于TestBaseObject: " << (intAccessor.IsApplicableTo(baseObj) ? "是" : "否") << std::endl;
+        std::cout << "  baseIntValue访问器适用于TestDerivedObject: " << (baseIntAccessor.IsApplicableTo(obj1) ? "是" : "否") << std::endl;
+
+        auto invalidAccessor = TestDerivedObject::GetClassPropertyAccessor("nonExistentProperty");
+        std::cout << "  不存在属性访问器IsValid(): " << (invalidAccessor.IsValid() ? "true" : "false") << std::endl;
+    }
+
+    // 测试2: 大量对象批量处理性能
+    {
+        std::cout << "\n测试2: 大量对象批量处理性能" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int OBJECT_COUNT = 100000;
+        std::vector<TestDerivedObject> objects(OBJECT_COUNT);
+        for (int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            objects[i].intValue1 = i % 100;
+        }
+
+        auto start = Clock::now();
+        long long sum = 0;
+        for (auto& obj : objects)
+        {
+            sum += obj.GetProperty("intValue1").GetValue<int>();
+        }
+        auto lookupDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        auto accessor = TestDerivedObject::GetClassPropertyAccessor("intValue1");
+        start = Clock::now();
+        long long accessorSum = 0;
+        for (auto& obj : objects)
+        {
+            accessorSum += accessor.Get<int>(obj);
+        }
+        auto accessorDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  逐对象GetProperty: " << lookupDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  类级访问器: " << accessorDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  验证和: " << sum << " / " << accessorSum << std::endl;
+    }
+}
+
+
+// ==================== 测试属性ID ====================
+
+void TestPropertyIds()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试属性ID（GetPropertyById / FindPropertyId）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: ID分配
+    {
+        std::cout << "\n测试1: ID分配（父类属性在前，自身属性在后）" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        std::cout << "  属性ID数量: " << obj.GetPropertyIdCount() << std::endl;
+        for (ROP::PropertyId id = 0; id < obj.GetPropertyIdCount(); ++id)
+        {
+            auto prop = obj.GetPropertyById(id);
+            std::cout << "    [" << id << "] " << prop.GetName() << " (类: " << prop.GetClassName() << ")" << std::endl;
+        }
+
+        ROP::PropertyId baseId = TestBaseObject::GetClassPropertyId("baseIntValue");
+        ROP::PropertyId derivedBaseId = obj.FindPropertyId("baseIntValue");
+        std::cout << "  baseIntValue在基类中的ID: " << baseId << ", 在派生类中的ID: " << derivedBaseId
+            << (baseId == derivedBaseId ? " (一致)" : " (不一致)") << std::endl;
+
+        auto invalidProp = obj.GetPropertyById(ROP::InvalidPropertyId);
+        std::cout << "  无效ID属性IsValid(): " << (invalidProp.IsValid() ? "true" : "false") << std::endl;
+        std::cout << "  不存在属性的ID: " << (obj.FindPropertyId("nonExistentProperty") == ROP::InvalidPropertyId ? "InvalidPropertyId" : "错误") << std::endl;
+    }
+
+    // 测试2: 同名属性（子类优先）
+    {
+        std::cout << "\n测试2: 同名属性（子类优先）" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        DerivedTestObject obj;
+        obj.mode = 2;
+        ROP::PropertyId modeId = obj.FindPropertyId("mode");
+        auto modeProp = obj.GetPropertyById(modeId);
+        std::cout << "  mode ID: " << modeId << ", 类: " << modeProp.GetClassName()
+            << ", 值: " << modeProp.GetValue<int>() << std::endl;
+        std::cout << "  Property::GetId(): " << obj.GetProperty("mode").GetId() << std::endl;
+    }
+
+    // 测试3: 性能对比
+    {
+        std::cout << "\n测试3: 按名称查找与按ID访问的性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        TestDerivedObject obj;
+        obj.intValue1 = 3;
+
+        auto start = Clock::now();
+        int sum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            sum += obj.GetProperty("intValue1").GetValue<int>();
+        }
+        auto nameDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        ROP::PropertyId id = obj.FindPropertyId("intValue1");
+        start = Clock::now();
+        int idSum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            idSum += obj.GetPropertyById(id).GetValue<int>();
+        }
+        auto idDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  GetProperty(name): " << nameDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  GetPropertyById(id): " << idDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  验证和: " << sum << " / " << idSum << std::endl;
+    }
+}
+
+
+// ==================== 测试异构键查找 ====================
+
+void TestHeterogeneousLookup()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试异构键查找（string_view / const char*）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 不同键类型查找结果一致
+    {
+        std::cout << "\n测试1: 不同键类型查找结果一致" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        DerivedTestObject obj;
+        obj.level = 2;
+
+        const char* cstrKey = "level";
+        std::string_view viewKey = "level";
+        std::string stringKey = "level";
+
+        std::cout << "  GetProperty(const char*): " << obj.GetProperty(cstrKey).GetValue<int>() << std::endl;
+        std::cout << "  GetProperty(string_view): " << obj.GetProperty(viewKey).GetValue<int>() << std::endl;
+        std::cout << "  GetProperty(std::string): " << obj.GetProperty(stringKey).GetValue<int>() << std::endl;
+        std::cout << "  HasProperty(string_view(\"tag\")): " << (obj.HasProperty(std::string_view("tag")) ? "true" : "false") << std::endl;
+        std::cout << "  HasProperty(\"unknown\"): " << (obj.HasProperty("unknown") ? "true" : "false") << std::endl;
+        std::cout << "  GetPropertyAsOptional(string_view): " << obj.GetPropertyAsOptional(viewKey).GetOptionString() << std::endl;
+        std::cout << "  GetPropertyDescription(string_view): " << obj.GetPropertyDescription(viewKey) << std::endl;
+        std::cout << "  FindPropertyId(string_view): " << obj.FindPropertyId(viewKey) << std::endl;
+
+        // 从较长的字符串中截取键（解析配置时的常见情况）
+        std::string configLine = "temperature=36.5";
+        std::string_view parsedKey = std::string_view(configLine).substr(0, configLine.find('='));
+        std::cout << "  解析得到的键 '" << parsedKey << "' 存在: " << (obj.HasProperty(parsedKey) ? "true" : "false") << std::endl;
+    }
+
+    // 测试2: 查找性能
+    {
+        std::cout << "\n测试2: 查找性能" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        TestDerivedObject obj;
+        const std::string keyName = "stringValue";
+        std::string_view viewKey = keyName;
+
+        auto start = Clock::now();
+        size_t count = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            count += obj.HasProperty(std::string(viewKey)) ? 1 : 0;
+        }
+        auto stringDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t viewCount = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            viewCount += obj.HasProperty(viewKey) ? 1 : 0;
+        }
+        auto viewDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  构造std::string后查找: " << stringDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  string_view直接查找: " << viewDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  命中次数: " << count << " / " << viewCount << std::endl;
+    }
+}
+
+
+void TestPerfectHashLookup()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试属性名称完美哈希索引" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 所有属性名称都能解析到正确的ID
+    {
+        std::cout << "\n测试1: 索引完整性" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        MiddleDerivedObject obj;
+        const auto& nameIndex = obj.GetPropertyData().propertyNameIndex;
+        std::cout << "  不重复名称数量: " << nameIndex.Size() << std::endl;
+        std::cout << "  完美哈希构建: " << (nameIndex.IsPerfect() ? "成功" : "退化为线性探测") << std::endl;
+
+        size_t mismatchCount = 0;
+        for (ROP::PropertyId id = 0; id < obj.GetPropertyIdCount(); ++id)
+        {
+            auto prop = obj.GetPropertyById(id);
+            ROP::PropertyId foundId = obj.FindPropertyId(prop.GetName());
+            // 同名属性解析为最靠近子类的那个
+            if (obj.GetPropertyById(foundId).GetName() != prop.GetName())
+            {
+                ++mismatchCount;
+            }
+        }
+        std::cout << "  名称解析不一致数量: " << mismatchCount << std::endl;
+        std::cout << "  不存在的属性: " << (obj.FindPropertyId("no_such_property") == ROP::InvalidPropertyId ? "InvalidPropertyId" : "错误") << std::endl;
+
+        ColorObject colorObj;
+        std::cout << "  枚举键类完美哈希构建: " << (colorObj.GetPropertyData().propertyNameIndex.IsPerfect() ? "成功" : "退化为线性探测") << std::endl;
+        std::cout << "  枚举键查找RED: " << (colorObj.HasProperty(ColorKey::RED) ? "true" : "false") << std::endl;
+    }
+
+    // 测试2: 查找性能（命中与未命中）
+    {
+        std::cout << "\n测试2: 查找性能" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        MiddleDerivedObject obj;
+        const std::string hitName = "base_int_5";
+        const std::string missName = "base_int_missing";
+
+        auto start = Clock::now();
+        size_t hitCount = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            hitCount += obj.FindPropertyId(hitName) != ROP::InvalidPropertyId ? 1 : 0;
+        }
+        auto hitDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t missCount = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            missCount += obj.FindPropertyId(missName) == ROP::InvalidPropertyId ? 1 : 0;
+        }
+        auto missDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  命中查找: " << hitDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  未命中查找: " << missDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  结果计数: " << hitCount << " / " << missCount << std::endl;
+    }
+}
+
+void TestMetadataArena()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试属性元数据存储区（元数据只存一份，各索引共享）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    // 测试1: 各索引指向同一份元数据
+    {
+        std::cout << "\n测试1: 索引共享元数据" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        MiddleDerivedObject middleObj;
+        LargeBaseObject baseObj;
+        const auto& data = middleObj.GetPropertyData();
+
+        // 自身属性列表、直接映射、ID表都指向本类存储区
+        const auto& firstOwn = middleObj.GetOwnPropertiesList()[0];
+        const auto& directMeta = middleObj.GetDirectPropertyMap().find(firstOwn.name)->second;
+        bool ownShared = &firstOwn == &data.propertyArena[0] && &directMeta == &firstOwn &&
+            data.propertyIdTable[firstOwn.propertyId] == &firstOwn;
+        std::cout << "  自身属性索引共享存储区: " << (ownShared ? "是" : "否") << std::endl;
+
+        // 继承的属性指向父类存储区，而不是副本
+        auto inheritedProp = middleObj.GetProperty("base_int_1");
+        auto baseProp = baseObj.GetProperty("base_int_1");
+        std::cout << "  继承属性与父类共享元数据: " << (inheritedProp.GetMetaPtr() == baseProp.GetMetaPtr() ? "是" : "否") << std::endl;
+
+        const auto& baseArena = baseObj.GetPropertyData().propertyArena;
+        size_t sharedCount = 0;
+        for (const auto& meta : middleObj.GetParentPropertiesList("LargeBaseObject"))
+        {
+            for (const auto& baseMeta : baseArena)
+            {
+                if (&meta == &baseMeta)
+                {
+                    ++sharedCount;
+                    break;
+                }
+            }
+        }
+        std::cout << "  父类属性列表共享数量: " << sharedCount << " / " << middleObj.GetParentPropertiesList("LargeBaseObject").size() << std::endl;
+    }
+
+    // 测试2: 元数据占用
+    {
+        std::cout << "\n测试2: 元数据占用" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        MiddleDerivedObject middleObj;
+        const auto& data = middleObj.GetPropertyData();
+        using MetaType = std::remove_reference_t<decltype(data.propertyArena[0])>;
+
+        std::cout << "  单个PropertyMeta大小: " << sizeof(MetaType) << " 字节" << std::endl;
+        std::cout << "  本类存储区元数据数量: " << data.propertyArena.size() << std::endl;
+        std::cout << "  所有属性数量（含继承）: " << middleObj.GetAllPropertiesList().size() << std::endl;
+        std::cout << "  索引中每项占用: " << sizeof(const MetaType*) << " 字节（指针）" << std::endl;
+    }
+}
+
+// ==================== 多层继承链测试类 ====================
+class ChainLevel1Object : public DerivedTestObject
+{
+    DECLARE_OBJECT_WITH_PARENT(ChainLevel1Object, DerivedTestObject)
+    registrar
+        .RegisterProperty(TestObjectType::INT, "level1Value", &ChainLevel1Object::level1Value, "第1层值");
+    END_DECLARE_OBJECT()
+
+public:
+    ChainLevel1Object() : level1Value(1) {}
+    int level1Value;
+};
+
+class ChainLevel2Object : public ChainLevel1Object
+{
+    DECLARE_OBJECT_WITH_PARENT(ChainLevel2Object, ChainLevel1Object)
+    registrar
+        .RegisterOptionalProperty(
+            TestObjectType::OPTIONAL, "mode", &ChainLevel2Object::chainMode,
+            { "Eco", "Boost" },
+            "第2层工作模式")
+        .RegisterProperty(TestObjectType::INT, "level2Value", &ChainLevel2Object::level2Value, "第2层值");
+    END_DECLARE_OBJECT()
+
+public:
+    ChainLevel2Object() : chainMode(0), level2Value(2) {}
+    int chainMode;
+    int level2Value;
+};
+
+class ChainLevel3Object : public ChainLevel2Object
+{
+    DECLARE_OBJECT_WITH_PARENT(ChainLevel3Object, ChainLevel2Object)
+    registrar
+        .RegisterProperty(TestObjectType::INT, "level3Value", &ChainLevel3Object::level3Value, "第3层值");
+    END_DECLARE_OBJECT()
+
+public:
+    ChainLevel3Object() : level3Value(3) {}
+    int level3Value;
+};
+
+void TestSharedParentData()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试共享父类属性数据（多层继承链）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    // 测试1: 父类链直接引用父类的属性数据
+    {
+        std::cout << "\n测试1: 父类链" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ChainLevel3Object obj;
+        ChainLevel2Object level2Obj;
+        const auto& data = obj.GetPropertyData();
+
+        std::cout << "  父类链:";
+        for (auto* parentData = data.parentData; parentData; parentData = parentData->parentData)
+        {
+            std::cout << " " << parentData->className;
+        }
+        std::cout << std::endl;
+        std::cout << "  父类数据为同一对象: " << (data.parentData == &level2Obj.GetPropertyData() ? "是" : "否") << std::endl;
+        std::cout << "  父类名称列表数量: " << obj.GetAllParentsName().size() << std::endl;
+        std::cout << "  所有属性数量: " << obj.GetPropertyCount() << std::endl;
+        std::cout << "  BaseTestObject属性数量: " << obj.GetParentPropertiesList("BaseTestObject").size() << std::endl;
+        std::cout << "  ChainLevel1Object属性映射数量: " << obj.GetParentClassPropertyMap("ChainLevel1Object").size() << std::endl;
+        std::cout << "  父类属性映射表类数: " << obj.GetParentPropertiesMap().size() << std::endl;
+        // 父类属性映射表只保存指向各祖先类自身映射表的指针，不复制映射表
+        bool parentMapsShared = true;
+        for (auto* parentData = data.parentData; parentData; parentData = parentData->parentData)
+        {
+            auto it = obj.GetParentPropertiesMap().find(parentData->className);
+            parentMapsShared = parentMapsShared && it != obj.GetParentPropertiesMap().end() && it->second == &parentData->directPropertyMap &&
+                &obj.GetParentClassPropertyMap(parentData->className) == &parentData->directPropertyMap;
+        }
+        std::cout << "  父类属性映射表指向祖先类自身的映射表（无复制）: " << (parentMapsShared ? "是" : "否") << std::endl;
+        std::cout << "  不存在的父类属性数量: " << obj.GetParentPropertiesList("UnknownClass").size() << std::endl;
+    }
+
+    // 测试2: 跨层访问属性和选项
+    {
+        std::cout << "\n测试2: 跨层访问属性和选项" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ChainLevel3Object obj;
+        obj.GetProperty("level1Value").SetValue<int>(10);
+        std::cout << "  level1Value: " << obj.level1Value << std::endl;
+        std::cout << "  level3Value: " << obj.GetProperty("level3Value").GetValue<int>() << std::endl;
+        std::cout << "  status所属类: " << obj.GetProperty("status").GetClassName() << std::endl;
+
+        auto modeOption = obj.GetPropertyAsOptional("mode");
+        std::cout << "  mode所属类: " << modeOption.GetClassName() << std::endl;
+        std::cout << "  mode合并后的选项数量: " << modeOption.GetOptionCount() << std::endl;
+        std::cout << "  设置mode为Boost: " << (modeOption.SetOptionByString("Boost") ? "成功" : "失败") << std::endl;
+        std::cout << "  chainMode: " << obj.chainMode << std::endl;
+
+        auto baseMode = obj.GetPropertyAsOptional("mode", "BaseTestObject");
+        std::cout << "  BaseTestObject::mode选项数量: " << baseMode.GetOptionCount() << std::endl;
+    }
+}
+
+void TestPropertyRanges()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试属性范围（按需生成Property，不分配内存）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 范围与列表版本结果一致
+    {
+        std::cout << "\n测试1: 范围与列表版本结果一致" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ChainLevel3Object obj;
+
+        size_t rangeCount = 0;
+        bool sameOrder = true;
+        auto orderedList = obj.GetAllPropertiesOrdered();
+        for (const auto& prop : obj.GetAllPropertiesRange())
+        {
+            if (rangeCount >= orderedList.size() || prop.GetMetaPtr() != orderedList[rangeCount].GetMetaPtr())
+            {
+                sameOrder = false;
+            }
+            ++rangeCount;
+        }
+        std::cout << "  GetAllPropertiesRange数量: " << rangeCount << " (列表: " << orderedList.size() << ")" <<
+            ", 顺序一致: " << (sameOrder ? "是" : "否") << std::endl;
+
+        std::cout << "  mode（有序）:";
+        for (const auto& prop : obj.GetPropertiesByNameOrderedRange("mode"))
+        {
+            std::cout << " " << prop.GetClassName();
+        }
+        std::cout << std::endl;
+
+        size_t byNameCount = 0;
+        for (const auto& prop : obj.GetAllPropertiesByNameRange("mode"))
+        {
+            if (prop.IsValid())
+                ++byNameCount;
+        }
+        std::cout << "  mode（多映射表）数量: " << byNameCount << " (列表: " << obj.GetAllPropertiesByName("mode").size() << ")" << std::endl;
+        std::cout << "  不存在的属性范围为空: " << (obj.GetPropertiesByNameOrderedRange("unknown").empty() ? "是" : "否") << std::endl;
+
+        // 范围中的Property可以直接读写
+        for (auto prop : obj.GetPropertiesByNameOrderedRange("level3Value"))
+        {
+            prop.SetValue<int>(33);
+        }
+        std::cout << "  通过范围设置level3Value: " << obj.level3Value << std::endl;
+    }
+
+    // 测试2: 每帧遍历所有属性的开销
+    {
+        std::cout << "\n测试2: 遍历所有属性的开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 100000;
+        MiddleDerivedObject obj;
+
+        auto start = Clock::now();
+        size_t listCount = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            for (const auto& prop : obj.GetAllPropertiesOrdered())
+            {
+                listCount += prop.GetType() == TestPropertyType::INT ? 1 : 0;
+            }
+        }
+        auto listDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t rangeCount = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            for (const auto& prop : obj.GetAllPropertiesRange())
+            {
+                rangeCount += prop.GetType() == TestPropertyType::INT ? 1 : 0;
+            }
+        }
+        auto rangeDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  GetAllPropertiesOrdered: " << listDuration.count() / static_cast<double>(ITERATIONS) << " ns/次遍历" << std::endl;
+        std::cout << "  GetAllPropertiesRange: " << rangeDuration.count() / static_cast<double>(ITERATIONS) << " ns/次遍历" << std::endl;
+        std::cout << "  INT属性计数: " << listCount << " / " << rangeCount << std::endl;
+    }
+}
+
+void TestPrecomputedClassQueries()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试预先构建的类级查询结果" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 查询结果
+    {
+        std::cout << "\n测试1: 查询结果" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ChainLevel3Object obj;
+
+        std::cout << "  BaseTestObject属性（按注册顺序）:";
+        for (const auto& meta : obj.GetParentClassProperties("BaseTestObject"))
+        {
+            std::cout << " " << meta.name;
+        }
+        std::cout << std::endl;
+        std::cout << "  本类属性数量: " << obj.GetParentClassProperties("ChainLevel3Object").size() << std::endl;
+        std::cout << "  DerivedTestObject映射中包含level: " << (obj.GetParentClassPropertyMap("DerivedTestObject").count("level") ? "是" : "否") << std::endl;
+        std::cout << "  不存在的类: " << obj.GetParentClassProperties("UnknownClass").size() << " / " << obj.GetParentClassPropertyMap("UnknownClass").size() << std::endl;
+
+        std::cout << "  不重复属性名称:";
+        for (const auto& name : obj.GetUniquePropertyNames())
+        {
+            std::cout << " " << name;
+        }
+        std::cout << std::endl;
+
+        // 同一个类的多个对象返回同一份数据
+        ChainLevel3Object other;
+        std::cout << "  多次调用返回同一份数据: " <<
+            (&obj.GetUniquePropertyNames() == &other.GetUniquePropertyNames() &&
+                &obj.GetParentClassProperties("BaseTestObject") == &other.GetParentClassProperties("BaseTestObject") ? "是" : "否") << std::endl;
+    }
+
+    // 测试2: 查询开销（模拟属性面板每次刷新）
+    {
+        std::cout << "\n测试2: 查询开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 100000;
+        ChainLevel3Object obj;
+
+        auto start = Clock::now();
+        size_t total = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            total += obj.GetParentClassProperties("BaseTestObject").size();
+            total += obj.GetParentClassPropertyMap("DerivedTestObject").size();
+            total += obj.GetUniquePropertyNames().size();
+        }
+        auto duration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  三个查询合计: " << duration.count() / static_cast<double>(ITERATIONS) << " ns/次刷新" << std::endl;
+        std::cout << "  验证和: " << total << std::endl;
+    }
+}
+
+// ==================== 零拷贝读取测试类 ====================
+class ZeroCopyTestObject : public ROP::PropertyObject<TestPropertyType>
+{
+    DECLARE_OBJECT(ZeroCopyTestObject)
+    registrar
+        .RegisterProperty(TestPropertyType::STRING, "name", &ZeroCopyTestObject::name, "名称")
+        .RegisterProperty(TestPropertyType::CUSTOM_TYPE, "samples", &ZeroCopyTestObject::samples, "采样数据")
+        .RegisterProperty(TestPropertyType::VECTOR3, "position", &ZeroCopyTestObject::position, "位置")
+        .RegisterProperty(
+            TestPropertyType::STRING, "label",
+            static_cast<void (ZeroCopyTestObject::*)(std::string&)>(&ZeroCopyTestObject::SetLabel),
+            static_cast<std::string & (ZeroCopyTestObject::*)()>(&ZeroCopyTestObject::GetLabel),
+            "标签（自定义访问器）");
+    END_DECLARE_OBJECT()
+
+public:
+    ZeroCopyTestObject() : position{ 1.0f, 2.0f, 3.0f } {}
+
+    void SetLabel(std::string& value) { label = value; }
+    std::string& GetLabel() { return label; }
+
+    std::string name;
+    std::vector<int> samples;
+    std::array<float, 3> position;
+    std::string label;
+};
+
+void TestZeroCopyReads()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试零拷贝读取（常量引用 / string_view / PropertySpan）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 视图指向属性存储
+    {
+        std::cout << "\n测试1: 视图指向属性存储" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ZeroCopyTestObject obj;
+        obj.name = "a sufficiently long name that does not fit in SSO";
+        obj.samples = { 1, 2, 3, 4, 5 };
+        obj.label = "custom";
+
+        std::string_view nameView = obj.GetProperty("name").GetStringView();
+        std::cout << "  name视图: " << nameView << std::endl;
+        std::cout << "  视图指向原字符串: " << (nameView.data() == obj.name.data() ? "是" : "否") << std::endl;
+
+        std::cout << "  label视图（自定义访问器）: " << obj.GetProperty("label").GetStringView() << std::endl;
+
+        auto samples = obj.GetProperty("samples").GetSpan<std::vector<int>>();
+        int sampleSum = 0;
+        for (int value : samples)
+        {
+            sampleSum += value;
+        }
+        std::cout << "  samples数量: " << samples.size() << ", 和: " << sampleSum <<
+            ", 指向原数组: " << (samples.data() == obj.samples.data() ? "是" : "否") << std::endl;
+
+        auto position = obj.GetTypedProperty<std::array<float, 3>>("position").GetSpan();
+        std::cout << "  position: (" << position[0] << ", " << position[1] << ", " << position[2] << ")" << std::endl;
+
+        auto typedName = obj.GetTypedProperty<std::string>("name");
+        std::cout << "  TypedProperty视图长度: " << typedName.GetStringView().size() << std::endl;
+    }
+
+    // 测试2: 读取字符串属性的开销
+    {
+        std::cout << "\n测试2: 读取字符串属性的开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        TestDerivedObject obj;
+        obj.stringValue = "performance_test_string_longer_than_sso";
+        auto stringProp = obj.GetProperty("stringValue");
+
+        auto start = Clock::now();
+        size_t copyLength = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            copyLength += stringProp.GetValue<std::string>().size();
+        }
+        auto copyDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t viewLength = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            viewLength += stringProp.GetStringView().size();
+        }
+        auto viewDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  GetValue<std::string>: " << copyDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  GetStringView: " << viewDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  长度和: " << copyLength << " / " << viewLength << std::endl;
+    }
+}
+
+// ==================== 移动赋值测试类 ====================
+// 统计拷贝和移动次数的负载类型
+struct CountedPayload
+{
+    static int copyCount;
+    static int moveCount;
+
+    std::string data;
+
+    CountedPayload() = default;
+    explicit CountedPayload(const std::string& value) : data(value) {}
+    CountedPayload(const CountedPayload& other) : data(other.data) { ++copyCount; }
+    CountedPayload(CountedPayload&& other) noexcept : data(std::move(other.data)) { ++moveCount; }
+    CountedPayload& operator=(const CountedPayload& other) { data = other.data; ++copyCount; return *this; }
+    CountedPayload& operator=(CountedPayload&& other) noexcept { data = std::move(other.data); ++moveCount; return *this; }
+
+    static void Reset() { copyCount = 0; moveCount = 0; }
+};
+int CountedPayload::copyCount = 0;
+int CountedPayload::moveCount = 0;
+
+class MoveTestObject : public ROP::PropertyObject<TestPropertyType>
+{
+    DECLARE_OBJECT(MoveTestObject)
+    registrar
+        .RegisterProperty(TestPropertyType::CUSTOM_TYPE, "payload", &MoveTestObject::payload, "成员变量负载")
+        .RegisterProperty(
+            TestPropertyType::CUSTOM_TYPE, "customPayload",
+            static_cast<void (MoveTestObject::*)(CountedPayload&&)>(&MoveTestObject::SetCustomPayload),
+            static_cast<CountedPayload & (MoveTestObject::*)()>(&MoveTestObject::GetCustomPayload),
+            "自定义访问器负载（右值setter）");
+    END_DECLARE_OBJECT()
+
+public:
+    void SetCustomPayload(CountedPayload&& value) { customPayload = std::move(value); }
+    CountedPayload& GetCustomPayload() { return customPayload; }
+
+    CountedPayload payload;
+    CountedPayload customPayload;
+};
+
+void TestMoveSetValue()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试右值SetValue（移动到属性中）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    // 测试1: 拷贝和移动次数
+    {
+        std::cout << "\n测试1: 拷贝和移动次数" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        MoveTestObject obj;
+        auto payloadProp = obj.GetProperty("payload");
+        auto customProp = obj.GetProperty("customPayload");
+        CountedPayload value("payload data");
+
+        CountedPayload::Reset();
+        payloadProp.SetValue<CountedPayload>(value);
+        std::cout << "  成员变量 SetValue(const T&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount << std::endl;
+
+        CountedPayload::Reset();
+        payloadProp.SetValue<CountedPayload>(CountedPayload("moved data"));
+        std::cout << "  成员变量 SetValue(T&&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount <<
+            ", 值: " << obj.payload.data << std::endl;
+
+        CountedPayload::Reset();
+        customProp.SetValue<CountedPayload>(value);
+        std::cout << "  自定义访问器 SetValue(const T&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount << std::endl;
+
+        CountedPayload::Reset();
+        customProp.SetValue(CountedPayload("custom moved"));
+        std::cout << "  自定义访问器 SetValue(T&&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount <<
+            ", 值: " << obj.customPayload.data << std::endl;
+
+        CountedPayload::Reset();
+        auto typedProp = obj.GetTypedProperty<CountedPayload>("customPayload");
+        typedProp.Set(CountedPayload("typed moved"));
+        std::cout << "  TypedProperty::Set(T&&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount << std::endl;
+
+        CountedPayload::Reset();
+        auto accessor = MoveTestObject::GetClassPropertyAccessor("payload");
+        accessor.Set(obj, CountedPayload("accessor moved"));
+        std::cout << "  PropertyAccessor::Set(T&&): 拷贝 " << CountedPayload::copyCount << ", 移动 " << CountedPayload::moveCount <<
+            ", 值: " << obj.payload.data << std::endl;
+    }
+
+    // 测试2: 左值仍然按拷贝语义设置
+    {
+        std::cout << "\n测试2: 左值保持拷贝语义" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::string text = "keep me";
+        TestDerivedObject derived;
+        derived.GetProperty("stringValue").SetValue(text);
+        std::cout << "  设置后原字符串: " << text << ", 属性值: " << derived.stringValue << std::endl;
+
+        derived.GetProperty("stringValue").SetValue(std::move(text));
+        std::cout << "  std::move设置后属性值: " << derived.stringValue << std::endl;
+    }
+}
+
+// 选项值不是int的选项属性（枚举、uint8_t成员，以及枚举类型的自定义访问器）
+enum class NarrowOptionMode : uint8_t
+{
+    Off,
+    Low,
+    High
+};
+
+class NarrowOptionObject : public ROP::PropertyObject<TestPropertyType>
+{
+    DECLARE_OBJECT(NarrowOptionObject)
+    registrar
+        .RegisterOptionalProperty(
+            TestPropertyType::OPTIONAL, "mode", &NarrowOptionObject::mode,
+            { "Off", "Low", "High" }, "枚举选项")
+        .RegisterOptionalProperty(
+            TestPropertyType::OPTIONAL, "level", &NarrowOptionObject::level,
+            { "L0", "L1", "L2", "L3" }, "uint8_t选项")
+        .RegisterOptionalProperty(
+            TestPropertyType::OPTIONAL, "fan", &NarrowOptionObject::SetFan, &NarrowOptionObject::GetFan,
+            { "Off", "Low", "High" }, "自定义访问器枚举选项");
+    END_DECLARE_OBJECT()
+
+public:
+    NarrowOptionObject() : mode(NarrowOptionMode::Off), level(0), fan(NarrowOptionMode::Off), fanSetCount(0) {}
+
+    void SetFan(NarrowOptionMode& value) { fan = value; ++fanSetCount; }
+    NarrowOptionMode& GetFan() { return fan; }
+
+    NarrowOptionMode mode;
+    uint8_t level;
+    NarrowOptionMode fan;
+    int fanSetCount;
+};
+
+void TestTypeIdCheck()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试类型ID检查" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 类型不匹配被拒绝
+    {
+        std::cout << "\n测试1: 类型不匹配被拒绝" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        auto stringProp = obj.GetProperty("stringValue");
+        auto intProp = obj.GetProperty("intValue1");
+
+        std::cout << "  GetPointer<int>(stringValue): " << (stringProp.GetPointer<int>() == nullptr ? "nullptr" : "非空") << std::endl;
+        std::cout << "  GetPointer<std::string>(stringValue): " << (stringProp.GetPointer<std::string>() != nullptr ? "非空" : "nullptr") << std::endl;
+
+        try
+        {
+            intProp.SetValue<double>(1.5);
+            std::cout << "  SetValue<double>(intValue1): 未检测到类型不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  SetValue<double>(intValue1): " << e.what() << std::endl;
+        }
+
+        try
+        {
+            auto accessor = TestDerivedObject::GetClassPropertyAccessor("stringValue");
+            accessor.Get<int>(obj);
+            std::cout << "  PropertyAccessor::Get<int>(stringValue): 未检测到类型不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  PropertyAccessor::Get<int>(stringValue): " << e.what() << std::endl;
+        }
+
+        std::cout << "  int与float类型ID不同: " << (ROP::GetPropertyTypeId<int>() != ROP::GetPropertyTypeId<float>() ? "是" : "否") << std::endl;
+    }
+
+    // 测试2: 类型检查开销
+    {
+        std::cout << "\n测试2: 类型检查开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+        TestDerivedObject obj;
+        obj.intValue1 = 7;
+        auto intProp = obj.GetProperty("intValue1");
+
+        auto start = Clock::now();
+        long long sum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            sum += intProp.GetValue<int>();
+        }
+        auto checkedDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        long long directSum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            directSum += obj.intValue1;
+        }
+        auto directDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  GetValue<int>（带类型检查）: " << checkedDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  直接访问: " << directDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  验证和: " << sum << " / " << directSum << std::endl;
+    }
+
+    // 测试3: 选项属性按注册类型读写（非int选项不应触发类型不匹配）
+    {
+        std::cout << "\n测试3: 非int选项属性" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        NarrowOptionObject obj;
+        obj.level = 2;
+        auto modeProp = obj.GetPropertyAsOptional("mode");
+        auto levelProp = obj.GetPropertyAsOptional("level");
+        auto fanProp = obj.GetPropertyAsOptional("fan");
+
+        modeProp.SetOptionByString("High");
+        fanProp.SetOptionByIndex(1);
+        std::cout << "  mode: " << modeProp.GetOptionString() << " (值: " << static_cast<int>(obj.mode) << ", 期望 High/2)" << std::endl;
+        std::cout << "  level: " << levelProp.GetOptionString() << " (值: " << static_cast<int>(obj.level) << ", 期望 L2/2)" << std::endl;
+        std::cout << "  fan: " << fanProp.GetOptionString() << " (setter调用次数: " << obj.fanSetCount << ", 期望 Low/1)" << std::endl;
+
+        std::string json;
+        ROP::ToJson(obj, json);
+        NarrowOptionObject copy;
+        ROP::FromJson(json, copy);
+        std::cout << "  JSON: " << json << std::endl;
+        std::cout << "  JSON往返后: mode " << static_cast<int>(copy.mode) << ", level " << static_cast<int>(copy.level) <<
+            ", fan " << static_cast<int>(copy.fan) << " (期望 2, 2, 1)" << std::endl;
+    }
+}
+
+void TestTryAccess()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试不抛异常的Try系列接口" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 各种状态码
+    {
+        std::cout << "\n测试1: 各种状态码" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        obj.intValue1 = 42;
+        obj.stringValue = "hello";
+
+        int intValue = -1;
+        std::cout << "  TryGetValue<int>(intValue1): " << ROP::PropertyStatusToString(obj.TryGetValue("intValue1", intValue)) << ", 值=" << intValue << std::endl;
+
+        intValue = -1;
+        std::cout << "  TryGetValue<int>(missing): " << ROP::PropertyStatusToString(obj.TryGetValue("missing", intValue)) << ", 值=" << intValue << std::endl;
+
+        float floatValue = -1.0f;
+        std::cout << "  TryGetValue<float>(intValue1): " << ROP::PropertyStatusToString(obj.TryGetValue("intValue1", floatValue)) << ", 值=" << floatValue << std::endl;
+
+        std::cout << "  TrySetValue(intValue1, 7): " << ROP::PropertyStatusToString(obj.TrySetValue("intValue1", 7)) << ", intValue1=" << obj.intValue1 << std::endl;
+        std::cout << "  TrySetValue(intValue1, 7.5): " << ROP::PropertyStatusToString(obj.TrySetValue("intValue1", 7.5)) << ", intValue1=" << obj.intValue1 << std::endl;
+
+        std::string newString = "moved";
+        std::cout << "  TrySetValue(stringValue, std::move): " << ROP::PropertyStatusToString(obj.TrySetValue("stringValue", std::move(newString)))
+            << ", stringValue=" << obj.stringValue << std::endl;
+
+        TestDerivedObject::ROPProperty prop;
+        std::cout << "  TryGetProperty(missing): " << ROP::PropertyStatusToString(obj.TryGetProperty("missing", prop)) << ", 有效=" << prop.IsValid() << std::endl;
+        std::cout << "  TryGetProperty(baseIntValue): " << ROP::PropertyStatusToString(obj.TryGetProperty("baseIntValue", prop)) << ", 有效=" << prop.IsValid() << std::endl;
+        std::cout << "  TryGetPropertyById(越界): " << ROP::PropertyStatusToString(obj.TryGetPropertyById(static_cast<ROP::PropertyId>(obj.GetPropertyIdCount()), prop)) << std::endl;
+
+        TestDerivedObject::ROPProperty invalidProp;
+        TestPropertyType type = TestPropertyType::BOOL;
+        std::cout << "  无效属性TryGetType: " << ROP::PropertyStatusToString(invalidProp.TryGetType(type)) << std::endl;
+        std::cout << "  无效属性TryGetValue: " << ROP::PropertyStatusToString(invalidProp.TryGetValue(intValue)) << std::endl;
+    }
+
+    // 测试2: 缺失属性时Try接口与异常接口的开销对比
+    {
+        std::cout << "\n测试2: 缺失属性时的开销对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        // 异常路径每次都会通过错误回调输出一行，迭代次数取小值
+        const int ITERATIONS = 100;
+        TestDerivedObject obj;
+        int value = 0;
+        int failures = 0;
+
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            if (obj.TryGetValue(std::string_view("missing"), value) != ROP::PropertyStatus::Ok)
+                ++failures;
+        }
+        auto tryDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        int exceptionFailures = 0;
+        start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            try
+            {
+                value = obj.GetProperty(std::string_view("missing")).GetValue<int>();
+            }
+            catch (const std::exception&)
+            {
+                ++exceptionFailures;
+            }
+        }
+        auto exceptionDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  TryGetValue: " << tryDuration.count() / static_cast<double>(ITERATIONS) << " ns/次, 失败次数=" << failures << std::endl;
+        std::cout << "  GetValue+异常: " << exceptionDuration.count() / static_cast<double>(ITERATIONS) << " ns/次, 失败次数=" << exceptionFailures << std::endl;
+    }
+}
+
+void TestErrorCounters()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试错误计数器和按需构造错误消息" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 所有报告点都使用SetErrorCallback设置的回调
+    {
+        std::cout << "\n测试1: 报告点统一使用设置的回调" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        CallbackTestObject obj;
+        ErrorCollector collector;
+        CallbackTestObject::SetErrorCallback(collector);
+        CallbackTestObject::ResetErrorCounts();
+
+        try { obj.GetProperty("missing").GetValue<int>(); } catch (...) {}
+        try { obj.GetProperty("name").GetValue<int>(); } catch (...) {}
+        try { obj.GetPropertyAsOptional("id"); } catch (...) {}
+
+        collector.PrintAllErrors();
+        std::cout << "  InvalidProperty计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::InvalidProperty) << std::endl;
+        std::cout << "  TypeMismatch计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::TypeMismatch) << std::endl;
+        std::cout << "  NotOptional计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::NotOptional) << std::endl;
+        std::cout << "  总计数: " << CallbackTestObject::GetTotalErrorCount() << std::endl;
+    }
+
+    // 测试2: 关闭错误输出后只计数，不构造消息
+    {
+        std::cout << "\n测试2: 关闭错误输出后只计数" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        CallbackTestObject obj;
+        ErrorCollector collector;
+        CallbackTestObject::SetErrorCallback(collector);
+        CallbackTestObject::SetErrorOutputEnabled(false);
+        CallbackTestObject::ResetErrorCounts();
+
+        int messageBuilt = 0;
+        CallbackTestObject::ReportError(ROP::PropertyErrorKind::Other, [&]()
+            {
+                ++messageBuilt;
+                return std::string("lazy message");
+            });
+        try { obj.GetProperty("missing").GetValue<int>(); } catch (...) {}
+
+        std::cout << "  消息构造次数: " << messageBuilt << std::endl;
+        std::cout << "  收集到的错误数量: " << collector.GetErrorCount() << std::endl;
+        std::cout << "  Other计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::Other) << std::endl;
+        std::cout << "  InvalidProperty计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::InvalidProperty) << std::endl;
+
+        CallbackTestObject::SetErrorOutputEnabled(true);
+        CallbackTestObject::ReportError(ROP::PropertyErrorKind::Other, [&]()
+            {
+                ++messageBuilt;
+                return std::string("lazy message");
+            });
+        std::cout << "  重新启用后消息构造次数: " << messageBuilt << ", 最后的错误: " << collector.GetLastError() << std::endl;
+    }
+
+    // 测试3: 错误风暴下关闭输出的开销
+    {
+        std::cout << "\n测试3: 错误风暴下的开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 100000;
+        CallbackTestObject::SetErrorOutputEnabled(false);
+        CallbackTestObject::ResetErrorCounts();
+
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            CallbackTestObject::ReportError(ROP::PropertyErrorKind::TypeMismatch, "Property type mismatch: cannot get value");
+        }
+        auto duration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  关闭输出时每次报告耗时: " << duration.count() / static_cast<double>(ITERATIONS) << " ns" << std::endl;
+        std::cout << "  TypeMismatch计数: " << CallbackTestObject::GetErrorCount(ROP::PropertyErrorKind::TypeMismatch) << std::endl;
+
+        CallbackTestObject::SetErrorOutputEnabled(true);
+        CallbackTestObject::ResetErrorCounts();
+    }
+}
+
+// ==================== 免检查访问策略测试类 ====================
+enum class UncheckedTestProperty
+{
+    INT,
+    DOUBLE,
+    STRING
+};
+
+// 该枚举对应的属性访问器不做有效性和类型检查
+namespace ROP
+{
+    template<>
+    struct PropertyAccessPolicy<UncheckedTestProperty>
+    {
+        static constexpr bool Checked = false;
+    };
+}
+
+class UncheckedTestObject : public ROP::PropertyObject<UncheckedTestProperty>
+{
+    DECLARE_OBJECT(UncheckedTestObject)
+    registrar
+        .RegisterProperty(UncheckedTestProperty::INT, "intValue", &UncheckedTestObject::intValue, "整数属性")
+        .RegisterProperty(UncheckedTestProperty::DOUBLE, "doubleValue", &UncheckedTestObject::doubleValue, "双精度属性")
+        .RegisterProperty(UncheckedTestProperty::STRING, "stringValue", &UncheckedTestObject::stringValue, "字符串属性");
+    END_DECLARE_OBJECT()
+
+public:
+    int intValue = 0;
+    double doubleValue = 0.0;
+    std::string stringValue;
+};
+
+void TestUncheckedAccessPolicy()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试免检查访问策略" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 免检查模式下的读写
+    {
+        std::cout << "\n测试1: 免检查模式下的读写" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        UncheckedTestObject obj;
+        auto intProp = obj.GetProperty("intValue");
+        auto doubleProp = obj.GetProperty("doubleValue");
+        auto stringProp = obj.GetProperty("stringValue");
+
+        intProp.SetValue<int>(42);
+        doubleProp.SetValue<double>(3.5);
+        stringProp.SetValue(std::string("unchecked"));
+        stringProp.GetReference<std::string>() += "!";
+
+        std::cout << "  intValue: " << intProp.GetValue<int>() << std::endl;
+        std::cout << "  doubleValue: " << doubleProp.GetValue<double>() << std::endl;
+        std::cout << "  stringValue: " << stringProp.GetConstReference<std::string>() << std::endl;
+
+        auto accessor = UncheckedTestObject::GetClassPropertyAccessor("intValue");
+        accessor.Set<int>(obj, 7);
+        std::cout << "  访问器读写intValue: " << accessor.Get<int>(obj) << std::endl;
+
+        // Try系列接口和返回指针的接口仍然检查
+        float wrongType = 0.0f;
+        std::cout << "  TryGetValue<float>(intValue): " << ROP::PropertyStatusToString(intProp.TryGetValue(wrongType)) << std::endl;
+        std::cout << "  GetPointer<float>(intValue): " << (intProp.GetPointer<float>() == nullptr ? "nullptr" : "非空") << std::endl;
+    }
+
+    // 测试2: 检查模式与免检查模式的开销对比
+    {
+        std::cout << "\n测试2: 检查模式与免检查模式的开销对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 1000000;
+
+        TestDerivedObject checkedObj;
+        checkedObj.intValue1 = 3;
+        auto checkedProp = checkedObj.GetProperty("intValue1");
+
+        UncheckedTestObject uncheckedObj;
+        uncheckedObj.intValue = 3;
+        auto uncheckedProp = uncheckedObj.GetProperty("intValue");
+
+        auto start = Clock::now();
+        long long checkedSum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            checkedProp.SetValue<int>(i & 0xff);
+            checkedSum += checkedProp.GetValue<int>();
+        }
+        auto checkedDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        long long uncheckedSum = 0;
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            uncheckedProp.SetValue<int>(i & 0xff);
+            uncheckedSum += uncheckedProp.GetValue<int>();
+        }
+        auto uncheckedDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  检查模式 SetValue+GetValue: " << checkedDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  免检查模式 SetValue+GetValue: " << uncheckedDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  验证和: " << checkedSum << " / " << uncheckedSum << std::endl;
+    }
+}
+
+void TestBatchAccess()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试按访问计划批量读写" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 批量读写不同类型的属性
+    {
+        std::cout << "\n测试1: 批量读写不同类型的属性" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        auto plan = obj.BuildAccessPlan({ "intValue1", "doubleValue", "stringValue", "baseIntValue", "boolValue" });
+        std::cout << "  计划属性数量: " << plan.Size() << std::endl;
+
+        int intValue = 11;
+        double doubleValue = 2.25;
+        std::string stringValue = "batch";
+        int baseIntValue = 99;
+        bool boolValue = true;
+        obj.SetValues(plan, { intValue, doubleValue, stringValue, baseIntValue, boolValue });
+
+        std::cout << "  SetValues后: intValue1=" << obj.intValue1 << ", doubleValue=" << obj.doubleValue
+            << ", stringValue=" << obj.stringValue << ", baseIntValue=" << obj.baseIntValue
+            << ", boolValue=" << obj.boolValue << std::endl;
+        std::cout << "  SetValues后调用方字符串保持不变: " << stringValue << std::endl;
+
+        std::string movedString = "moved batch";
+        obj.MoveValues(plan, { intValue, doubleValue, movedString, baseIntValue, boolValue });
+        std::cout << "  MoveValues后: stringValue=" << obj.stringValue << ", 调用方字符串" << (movedString.empty() ? "已被移动" : "未被移动") << std::endl;
+
+        // 自定义setter会修改传入的值（超出范围时截断），SetValues只把副本交给setter
+        TestCustomAccessorObject customObj;
+        auto customPlan = customObj.BuildAccessPlan({ "customInt", "customString" });
+        int customInt = 5000;
+        std::string customString = "custom batch";
+        customObj.SetValues(customPlan, { customInt, customString });
+        std::cout << "  自定义访问器SetValues: customInt=" << customObj.GetCustomInt() << ", 调用方值=" << customInt
+            << ", customString=" << customObj.GetCustomString() << ", 调用方字符串=" << customString << std::endl;
+
+        int outInt = 0;
+        double outDouble = 0.0;
+        std::string outString;
+        int outBaseInt = 0;
+        bool outBool = false;
+        obj.GetValues(plan, { outInt, outDouble, outString, outBaseInt, outBool });
+        std::cout << "  GetValues: " << outInt << ", " << outDouble << ", " << outString << ", " << outBaseInt << ", " << outBool << std::endl;
+
+        // 按ID构建的计划，父类计划可用于子类对象
+        TestBaseObject baseObj;
+        auto basePlan = baseObj.BuildAccessPlanByIds({ baseObj.FindPropertyId("baseIntValue"), baseObj.FindPropertyId("baseStringValue") });
+        int derivedBaseInt = 0;
+        std::string derivedBaseString = "ignored";
+        obj.baseStringValue = "from derived";
+        obj.GetValues(basePlan, { derivedBaseInt, derivedBaseString });
+        std::cout << "  父类计划读取子类对象: " << derivedBaseInt << ", " << derivedBaseString << std::endl;
+    }
+
+    // 测试2: 校验失败时对象保持不变
+    {
+        std::cout << "\n测试2: 校验失败时对象保持不变" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        TestDerivedObject obj;
+        obj.intValue1 = 1;
+        obj.intValue2 = 2;
+        auto plan = obj.BuildAccessPlan({ "intValue1", "intValue2" });
+
+        int first = 100;
+        float wrongType = 200.0f;
+        try
+        {
+            obj.SetValues(plan, { first, wrongType });
+            std::cout << "  未检测到类型不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  捕获异常: " << e.what() << std::endl;
+        }
+        std::cout << "  intValue1=" << obj.intValue1 << ", intValue2=" << obj.intValue2 << std::endl;
+
+        try
+        {
+            obj.SetValues(plan, { first });
+            std::cout << "  未检测到数量不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  捕获异常: " << e.what() << std::endl;
+        }
+
+        TestBaseObject baseObj;
+        int a = 0;
+        int b = 0;
+        try
+        {
+            baseObj.GetValues(plan, { a, b });
+            std::cout << "  未检测到计划不适用" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  捕获异常: " << e.what() << std::endl;
+        }
+
+        try
+        {
+            obj.BuildAccessPlan({ "intValue1", "missing" });
+            std::cout << "  未检测到属性不存在" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  捕获异常: " << e.what() << std::endl;
+        }
+    }
+
+    // 测试3: 批量设置与逐个设置的开销对比
+    {
+        std::cout << "\n测试3: 批量设置与逐个设置的开销对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int ITERATIONS = 100000;
+        TestDerivedObject obj;
+        const std::vector<std::string> names = { "intValue1", "intValue2", "intValue3", "baseIntValue",
+            "floatValue1", "floatValue2", "baseFloatValue", "doubleValue" };
+        auto plan = obj.BuildAccessPlan(names);
+
+        int i1 = 0, i2 = 0, i3 = 0, i4 = 0;
+        float f1 = 0.0f, f2 = 0.0f, f3 = 0.0f;
+        double d1 = 0.0;
+
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            i1 = i; i2 = i + 1; i3 = i + 2; i4 = i + 3;
+            f1 = 1.0f; f2 = 2.0f; f3 = 3.0f; d1 = i * 0.5;
+            obj.GetProperty(names[0]).SetValue<int>(i1);
+            obj.GetProperty(names[1]).SetValue<int>(i2);
+            obj.GetProperty(names[2]).SetValue<int>(i3);
+            obj.GetProperty(names[3]).SetValue<int>(i4);
+            obj.GetProperty(names[4]).SetValue<float>(f1);
+            obj.GetProperty(names[5]).SetValue<float>(f2);
+            obj.GetProperty(names[6]).SetValue<float>(f3);
+            obj.GetProperty(names[7]).SetValue<double>(d1);
+        }
+        auto singleDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+        long long singleCheck = obj.intValue1 + obj.baseIntValue;
+
+        start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i)
+        {
+            i1 = i; i2 = i + 1; i3 = i + 2; i4 = i + 3;
+            f1 = 1.0f; f2 = 2.0f; f3 = 3.0f; d1 = i * 0.5;
+            obj.SetValues(plan, { i1, i2, i3, i4, f1, f2, f3, d1 });
+        }
+        auto batchDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+        long long batchCheck = obj.intValue1 + obj.baseIntValue;
+
+        std::cout << "  逐个GetProperty+SetValue（8个属性）: " << singleDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  SetValues（8个属性）: " << batchDuration.count() / static_cast<double>(ITERATIONS) << " ns/次" << std::endl;
+        std::cout << "  验证和: " << singleCheck << " / " << batchCheck << std::endl;
+    }
+}
+
+// ==================== 列式读写测试类 ====================
+class ColumnTestObject : public ROP::PropertyObject<TestPropertyType>
+{
+    DECLARE_OBJECT(ColumnTestObject)
+    registrar
+        .RegisterProperty(TestPropertyType::FLOAT, "currentTemp", &ColumnTestObject::currentTemp, "当前温度")
+        .RegisterProperty(TestPropertyType::INT, "sampleCount", &ColumnTestObject::sampleCount, "采样次数")
+        .RegisterProperty(
+            TestPropertyType::DOUBLE, "calibration",
+            static_cast<void (ColumnTestObject::*)(double&)>(&ColumnTestObject::SetCalibration),
+            static_cast<double& (ColumnTestObject::*)()>(&ColumnTestObject::GetCalibration),
+            "校准系数（自定义访问器）");
+    END_DECLARE_OBJECT()
+
+public:
+    void SetCalibration(double& value) { calibration = value; ++calibrationSetCount; }
+    double& GetCalibration() { return calibration; }
+
+    float currentTemp = 0.0f;
+    int sampleCount = 0;
+    double calibration = 1.0;
+    int calibrationSetCount = 0;
+};
+
+// 派生类：父类属性的ID在子类中保持不变
+class ColumnDerivedObject : public ColumnTestObject
+{
+    DECLARE_OBJECT_WITH_PARENT(ColumnDerivedObject, ColumnTestObject)
+    registrar
+        .RegisterProperty(TestPropertyType::STRING, "label", &ColumnDerivedObject::label, "标签");
+    END_DECLARE_OBJECT()
+
+public:
+    std::string label;
+};
+
+void TestColumnGather()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试列式读取（Gather）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 混合类的对象集合
+    {
+        std::cout << "\n测试1: 混合类的对象集合" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::vector<std::unique_ptr<ColumnTestObject>> storage;
+        std::vector<ColumnTestObject*> objects;
+        for (int i = 0; i < 6; ++i)
+        {
+            if (i % 3 == 2)
+                storage.push_back(std::make_unique<ColumnDerivedObject>());
+            else
+                storage.push_back(std::make_unique<ColumnTestObject>());
+            storage.back()->currentTemp = 20.0f + i;
+            storage.back()->calibration = 1.0 + i * 0.1;
+            objects.push_back(storage.back().get());
+        }
+
+        ROP::PropertyId tempId = ColumnTestObject::GetClassPropertyId("currentTemp");
+        ROP::PropertyId calibrationId = ColumnTestObject::GetClassPropertyId("calibration");
+
+        std::vector<float> temps(objects.size());
+        std::vector<double> calibrations(objects.size());
+        ROP::Gather(objects, tempId, temps.data());
+        ROP::Gather(objects, calibrationId, calibrations.data());
+
+        std::cout << "  currentTemp:";
+        for (float t : temps) std::cout << " " << t;
+        std::cout << std::endl;
+        std::cout << "  calibration:";
+        for (double c : calibrations) std::cout << " " << c;
+        std::cout << std::endl;
+
+        std::vector<float> accessorTemps(objects.size());
+        ROP::Gather(objects, ColumnTestObject::GetClassPropertyAccessor("currentTemp"), accessorTemps.data());
+        std::cout << "  访问器版本结果一致: " << (accessorTemps == temps ? "是" : "否") << std::endl;
+
+        std::vector<int> wrongType(objects.size());
+        try
+        {
+            ROP::Gather(objects, tempId, wrongType.data());
+            std::cout << "  未检测到类型不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  类型不匹配: " << e.what() << std::endl;
+        }
+
+        try
+        {
+            ROP::Gather(objects, ColumnDerivedObject::GetClassPropertyId("label"), temps.data());
+            std::cout << "  未检测到ID越界" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  子类ID用于父类对象: " << e.what() << std::endl;
+        }
+    }
+
+    // 测试2: 大量对象的读取开销
+    {
+        std::cout << "\n测试2: 大量对象的读取开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const size_t OBJECT_COUNT = 200000;
+        std::vector<ColumnTestObject> storage(OBJECT_COUNT);
+        std::vector<ColumnTestObject*> objects;
+        objects.reserve(OBJECT_COUNT);
+        for (size_t i = 0; i < OBJECT_COUNT; ++i)
+        {
+            storage[i].currentTemp = static_cast<float>(i % 100);
+            objects.push_back(&storage[i]);
+        }
+        std::vector<float> temps(OBJECT_COUNT);
+
+        auto start = Clock::now();
+        for (size_t i = 0; i < OBJECT_COUNT; ++i)
+        {
+            temps[i] = objects[i]->GetProperty("currentTemp").GetValue<float>();
+        }
+        auto perObjectDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+        double perObjectSum = 0.0;
+        for (float t : temps) perObjectSum += t;
+
+        ROP::PropertyId tempId = ColumnTestObject::GetClassPropertyId("currentTemp");
+        start = Clock::now();
+        ROP::Gather(objects, tempId, temps.data());
+        auto gatherDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+        double gatherSum = 0.0;
+        for (float t : temps) gatherSum += t;
+
+        auto accessor = ColumnTestObject::GetClassPropertyAccessor("currentTemp");
+        start = Clock::now();
+        ROP::Gather(objects, accessor, temps.data());
+        auto accessorDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  逐对象GetProperty+GetValue: " << perObjectDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  Gather（按属性ID）: " << gatherDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  Gather（类级访问器）: " << accessorDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  验证和: " << perObjectSum << " / " << gatherSum << std::endl;
+    }
+}
+
+void TestColumnScatter()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试列式写入（Scatter）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 成员变量属性和自定义访问器属性
+    {
+        std::cout << "\n测试1: 成员变量属性和自定义访问器属性" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::vector<std::unique_ptr<ColumnTestObject>> storage;
+        std::vector<ColumnTestObject*> objects;
+        for (int i = 0; i < 5; ++i)
+        {
+            if (i % 2 == 1)
+                storage.push_back(std::make_unique<ColumnDerivedObject>());
+            else
+                storage.push_back(std::make_unique<ColumnTestObject>());
+            objects.push_back(storage.back().get());
+        }
+
+        const std::vector<int> counts = { 10, 20, 30, 40, 50 };
+        const std::vector<double> calibrations = { 0.5, 0.6, 0.7, 0.8, 0.9 };
+        ROP::Scatter(objects, ColumnTestObject::GetClassPropertyId("sampleCount"), counts.data());
+        ROP::Scatter(objects, ColumnTestObject::GetClassPropertyId("calibration"), calibrations.data());
+
+        std::cout << "  sampleCount/calibration/setter调用次数:";
+        for (auto* obj : objects)
+        {
+            std::cout << " " << obj->sampleCount << "/" << obj->calibration << "/" << obj->calibrationSetCount;
+        }
+        std::cout << std::endl;
+
+        const std::vector<float> temps = { 1.5f, 2.5f, 3.5f, 4.5f, 5.5f };
+        ROP::Scatter(objects, ColumnTestObject::GetClassPropertyAccessor("currentTemp"), temps.data());
+        std::vector<float> readBack(objects.size());
+        ROP::Gather(objects, ColumnTestObject::GetClassPropertyId("currentTemp"), readBack.data());
+        std::cout << "  访问器写入后读回一致: " << (readBack == temps ? "是" : "否") << std::endl;
+
+        const std::vector<double> wrongType = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+        try
+        {
+            ROP::Scatter(objects, ColumnTestObject::GetClassPropertyId("sampleCount"), wrongType.data());
+            std::cout << "  未检测到类型不匹配" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  类型不匹配: " << e.what() << ", sampleCount[0]=" << objects[0]->sampleCount << std::endl;
+        }
+    }
+
+    // 测试2: 大量对象的写入开销
+    {
+        std::cout << "\n测试2: 大量对象的写入开销" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const size_t OBJECT_COUNT = 200000;
+        std::vector<ColumnTestObject> storage(OBJECT_COUNT);
+        std::vector<ColumnTestObject*> objects;
+        objects.reserve(OBJECT_COUNT);
+        std::vector<float> temps(OBJECT_COUNT);
+        for (size_t i = 0; i < OBJECT_COUNT; ++i)
+        {
+            objects.push_back(&storage[i]);
+            temps[i] = static_cast<float>(i % 50);
+        }
+
+        auto start = Clock::now();
+        for (size_t i = 0; i < OBJECT_COUNT; ++i)
+        {
+            objects[i]->GetProperty("currentTemp").SetValue<float>(temps[i]);
+        }
+        auto perObjectDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        ROP::PropertyId tempId = ColumnTestObject::GetClassPropertyId("currentTemp");
+        start = Clock::now();
+        ROP::Scatter(objects, tempId, temps.data());
+        auto scatterDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        double sum = 0.0;
+        for (const auto& obj : storage) sum += obj.currentTemp;
+
+        std::cout << "  逐对象GetProperty+SetValue: " << perObjectDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  Scatter（按属性ID）: " << scatterDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  验证和: " << sum << std::endl;
+    }
+}
+
+void TestPropertyAggregates()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试数值属性聚合" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    const size_t OBJECT_COUNT = 300000;
+    std::vector<ColumnTestObject> storage(OBJECT_COUNT);
+    std::vector<ColumnTestObject*> objects;
+    objects.reserve(OBJECT_COUNT);
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> tempDist(-400, 600);
+    for (size_t i = 0; i < OBJECT_COUNT; ++i)
+    {
+        storage[i].currentTemp = tempDist(rng) * 0.1f;
+        storage[i].sampleCount = static_cast<int>(i % 1000);
+        objects.push_back(&storage[i]);
+    }
+
+    ROP::PropertyId tempId = ColumnTestObject::GetClassPropertyId("currentTemp");
+    ROP::PropertyId countId = ColumnTestObject::GetClassPropertyId("sampleCount");
+
+    // 测试1: 聚合结果与逐个计算一致
+    {
+        std::cout << "\n测试1: 聚合结果与逐个计算一致" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        double expectedSum = 0.0;
+        float expectedMin = storage[0].currentTemp;
+        float expectedMax = storage[0].currentTemp;
+        long long expectedCountSum = 0;
+        for (const auto& obj : storage)
+        {
+            expectedSum += obj.currentTemp;
+            expectedMin = std::min(expectedMin, obj.currentTemp);
+            expectedMax = std::max(expectedMax, obj.currentTemp);
+            expectedCountSum += obj.sampleCount;
+        }
+
+        auto stats = ROP::ComputeStatistics<float>(objects, tempId);
+        std::cout << "  数量: " << stats.count << std::endl;
+        std::cout << "  Sum<float>: " << ROP::Sum<float>(objects, tempId) << " (逐个: " << expectedSum << ")" << std::endl;
+        std::cout << "  Min/Max<float>: " << ROP::Min<float>(objects, tempId) << " / " << ROP::Max<float>(objects, tempId)
+            << " (逐个: " << expectedMin << " / " << expectedMax << ")" << std::endl;
+        std::cout << "  Mean<float>: " << ROP::Mean<float>(objects, tempId) << " / 统计结果: " << stats.Mean() << std::endl;
+        std::cout << "  Sum<int>: " << ROP::Sum<int>(objects, countId) << " (逐个: " << expectedCountSum << ")" << std::endl;
+
+        auto bins = ROP::Histogram<float>(objects, tempId, -40.0, 60.0, 5);
+        size_t binTotal = 0;
+        std::cout << "  Histogram(-40, 60, 5):";
+        for (size_t bin : bins)
+        {
+            std::cout << " " << bin;
+            binTotal += bin;
+        }
+        std::cout << " (合计 " << binTotal << ")" << std::endl;
+
+        std::vector<ColumnTestObject*> empty;
+        auto emptyStats = ROP::ComputeStatistics<float>(empty, tempId);
+        std::cout << "  空集合: count=" << emptyStats.count << ", mean=" << emptyStats.Mean() << std::endl;
+    }
+
+    // 测试2: 聚合与逐对象读取的开销对比
+    {
+        std::cout << "\n测试2: 聚合与逐对象读取的开销对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        auto start = Clock::now();
+        double perObjectSum = 0.0;
+        for (auto* obj : objects)
+        {
+            perObjectSum += obj->GetProperty("currentTemp").GetValue<float>();
+        }
+        auto perObjectDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        double aggregateSum = ROP::Sum<float>(objects, tempId);
+        auto aggregateDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        auto stats = ROP::ComputeStatistics<float>(objects, tempId);
+        auto statsDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  逐对象GetProperty+GetValue求和: " << perObjectDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  Sum: " << aggregateDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  ComputeStatistics: " << statsDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  验证和: " << std::fixed << std::setprecision(1) << perObjectSum << " / " << aggregateSum << " / " << stats.sum << std::endl;
+        std::cout << std::setprecision(2);
+    }
+
+    // 测试3: 非有限值、非法范围与无符号求和
+    {
+        std::cout << "\n测试3: 非有限值、非法范围与无符号求和" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::vector<ColumnTestObject> special(6);
+        std::vector<ColumnTestObject*> specialObjects;
+        const float specialValues[] = { std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(), 1.0f, 5.0f, 9.0f };
+        for (size_t i = 0; i < special.size(); ++i)
+        {
+            special[i].currentTemp = specialValues[i];
+            specialObjects.push_back(&special[i]);
+        }
+
+        size_t skipped = 0;
+        auto bins = ROP::Histogram<float>(specialObjects, tempId, 0.0, 10.0, 2, &skipped);
+        std::cout << "  Histogram(0, 10, 2): " << bins[0] << " " << bins[1] << ", 跳过NaN: " << skipped << " (期望 2 3, 1)" << std::endl;
+
+        bins = ROP::Histogram<float>(specialObjects, tempId, 5.0, 5.0, 3, &skipped);
+        std::cout << "  Histogram(5, 5, 3): " << bins[0] << " " << bins[1] << " " << bins[2] << " (期望 5 0 0)" << std::endl;
+
+        try
+        {
+            ROP::Histogram<float>(specialObjects, tempId, 10.0, 0.0, 2);
+            std::cout << "  Histogram(10, 0): 未检测到非法范围" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  Histogram(10, 0): " << e.what() << std::endl;
+        }
+
+        // 和超出int64_t范围，但在uint64_t范围内
+        const unsigned long long largeValues[] = { 1ULL << 63, 1ULL << 62, 1ULL << 61 };
+        const uint64_t unsignedSum = ROP::PropertyAggregateKernels<unsigned long long>::Sum(largeValues, 3);
+        std::cout << "  unsigned long long求和: " << unsignedSum << " (期望 16140901064495857664)" << std::endl;
+    }
+
+    // 测试4: Min/Max跳过NaN（NaN位于开头、块中间以及全为NaN）
+    {
+        std::cout << "\n测试4: Min/Max跳过NaN" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+
+        // 第一块开头为NaN，第二块中间为NaN
+        std::vector<ColumnTestObject> nanStorage(ROP::PropertyAggregateChunkSize + 100);
+        std::vector<ColumnTestObject*> nanObjects;
+        for (size_t i = 0; i < nanStorage.size(); ++i)
+        {
+            nanStorage[i].currentTemp = static_cast<float>(i % 50) + 1.0f;
+            nanObjects.push_back(&nanStorage[i]);
+        }
+        nanStorage[0].currentTemp = nan;
+        nanStorage[ROP::PropertyAggregateChunkSize + 50].currentTemp = nan;
+
+        auto nanStats = ROP::ComputeStatistics<float>(nanObjects, tempId);
+        std::cout << "  NaN位于开头和块中间: min=" << nanStats.min << ", max=" << nanStats.max
+            << ", sum为NaN: " << (std::isnan(nanStats.sum) ? "是" : "否") << " (期望 min=1.00, max=50.00, 是)" << std::endl;
+
+        // 块内只有开头一个值为NaN
+        std::vector<ColumnTestObject> small(3);
+        std::vector<ColumnTestObject*> smallObjects;
+        const float smallValues[] = { nan, 7.0f, -2.0f };
+        for (size_t i = 0; i < small.size(); ++i)
+        {
+            small[i].currentTemp = smallValues[i];
+            smallObjects.push_back(&small[i]);
+        }
+        std::cout << "  {NaN, 7, -2}: min=" << ROP::Min<float>(smallObjects, tempId)
+            << ", max=" << ROP::Max<float>(smallObjects, tempId) << " (期望 min=-2.00, max=7.00)" << std::endl;
+
+        // 全为NaN时与空集合一致
+        for (auto& object : small)
+            object.currentTemp = nan;
+        auto allNanStats = ROP::ComputeStatistics<float>(smallObjects, tempId);
+        std::cout << "  全为NaN: min=" << allNanStats.min << ", max=" << allNanStats.max
+            << ", count=" << allNanStats.count << " (期望 min=0.00, max=0.00, count=3)" << std::endl;
+    }
+}
+
+void TestParallelForEach()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试并行遍历对象集合" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    const size_t OBJECT_COUNT = 200000;
+    std::vector<ColumnTestObject> storage(OBJECT_COUNT);
+    std::vector<ColumnTestObject*> objects;
+    objects.reserve(OBJECT_COUNT);
+    for (size_t i = 0; i < OBJECT_COUNT; ++i)
+    {
+        storage[i].currentTemp = static_cast<float>(i % 100);
+        storage[i].calibration = 1.0;
+        objects.push_back(&storage[i]);
+    }
+
+    ROP::PropertyThreadPool pool(4);
+
+    // 测试1: 结果正确性
+    {
+        std::cout << "\n测试1: 结果正确性" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+        std::cout << "  工作线程数: " << pool.GetThreadCount() << std::endl;
+
+        ROP::ParallelForEach(objects, [](ColumnTestObject& obj)
+            {
+                obj.GetProperty("sampleCount").SetValue<int>(static_cast<int>(obj.currentTemp) * 2);
+            }, pool);
+        long long countSum = 0;
+        for (const auto& obj : storage) countSum += obj.sampleCount;
+        std::cout << "  ParallelForEach后sampleCount之和: " << countSum << " (期望 " << 2LL * (OBJECT_COUNT / 100) * 4950 << ")" << std::endl;
+
+        ROP::ParallelApply<float>(objects, ColumnTestObject::GetClassPropertyAccessor("currentTemp"), [](float& value) { value += 1.0f; }, pool);
+        ROP::ParallelApply<double>(objects, ColumnTestObject::GetClassPropertyAccessor("calibration"), [](double& value) { value *= 2.0; }, pool);
+        double tempSum = 0.0;
+        double calibrationSum = 0.0;
+        int setterCalls = 0;
+        for (const auto& obj : storage)
+        {
+            tempSum += obj.currentTemp;
+            calibrationSum += obj.calibration;
+            setterCalls += obj.calibrationSetCount;
+        }
+        std::cout << "  ParallelApply后currentTemp之和: " << tempSum << ", calibration之和: " << calibrationSum
+            << ", setter调用次数: " << setterCalls << std::endl;
+
+        try
+        {
+            ROP::ParallelForEach(objects, [](ColumnTestObject& obj)
+                {
+                    if (obj.currentTemp > 99.5f)
+                        throw std::runtime_error("task failed");
+                }, pool);
+            std::cout << "  未传播任务异常" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << "  任务异常传播到调用线程: " << e.what() << std::endl;
+        }
+
+        // 任务内嵌套并行
+        std::atomic<size_t> nestedCount(0);
+        pool.ParallelFor(8, 1, [&](size_t, size_t)
+            {
+                pool.ParallelFor(1000, 100, [&](size_t begin, size_t end) { nestedCount += end - begin; });
+            });
+        std::cout << "  嵌套ParallelFor处理数量: " << nestedCount.load() << std::endl;
+
+        // 大量短小的ParallelFor：每次调用返回后其完成状态不能再被任务访问
+        size_t shortTotal = 0;
+        for (int round = 0; round < 2000; ++round)
+        {
+            std::atomic<size_t> shortCount(0);
+            pool.ParallelFor(16, 1, [&](size_t begin, size_t end) { shortCount += end - begin; });
+            shortTotal += shortCount.load();
+        }
+        std::cout << "  2000次短ParallelFor处理数量: " << shortTotal << " (期望 " << 2000 * 16 << ")" << std::endl;
+
+        // 默认线程池需要显式回收，回收后再次使用会重新创建
+        std::atomic<size_t> defaultCount(0);
+        ROP::PropertyThreadPool::Default().ParallelFor(4096, 256, [&](size_t begin, size_t end) { defaultCount += end - begin; });
+        ROP::PropertyThreadPool::ShutdownDefault();
+        ROP::PropertyThreadPool::Default().ParallelFor(4096, 256, [&](size_t begin, size_t end) { defaultCount += end - begin; });
+        ROP::PropertyThreadPool::ShutdownDefault();
+        std::cout << "  默认线程池回收前后处理数量: " << defaultCount.load() << " (期望 8192)" << std::endl;
+    }
+
+    // 测试2: 串行与并行的开销对比
+    {
+        std::cout << "\n测试2: 串行与并行的开销对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        auto work = [](ColumnTestObject& obj)
+            {
+                float value = obj.GetProperty("currentTemp").GetValue<float>();
+                for (int k = 0; k < 20; ++k)
+                    value = value * 0.99f + 0.5f;
+                obj.GetProperty("currentTemp").SetValue<float>(value);
+            };
+
+        auto start = Clock::now();
+        for (auto* obj : objects) work(*obj);
+        auto serialDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        ROP::ParallelForEach(objects, work, pool);
+        auto parallelDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "  串行: " << serialDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+        std::cout << "  并行（" << pool.GetThreadCount() << "个工作线程+调用线程）: " << parallelDuration.count() / static_cast<double>(OBJECT_COUNT) << " ns/对象" << std::endl;
+    }
+}
+
+void TestBinarySerializer()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试二进制序列化（Serialize/Deserialize）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 序列化计划
+    {
+        std::cout << "\n测试1: 序列化计划" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        using Plan = ROP::PropertyBinaryPlan<LargeBaseObject::ROPObjectType>;
+        LargeBaseObject obj;
+        const Plan& plan = Plan::Get(obj.GetPropertyData());
+        std::cout << "  LargeBaseObject: 属性数=" << obj.GetAllPropertiesList().size()
+            << ", memcpy段数=" << plan.GetCopyRunCount()
+            << ", 按字节复制的大小=" << plan.GetFixedSize()
+            << ", 逐个编码的属性数=" << plan.GetValueStepCount() << std::endl;
+        std::cout << "  再次获取返回同一计划: " << (&Plan::Get(obj.GetPropertyData()) == &plan ? "是" : "否") << std::endl;
+    }
+
+    // 测试2: 往返编码
+    {
+        std::cout << "\n测试2: 往返编码" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        LargeBaseObject source;
+        source.base_int_3 = 300;
+        source.base_float_5 = -2.5f;
+        source.base_string_2 = "serialized";
+        source.base_bool_2 = true;
+
+        ROP::PropertyBinaryBuffer buffer;
+        ROP::Serialize(source, buffer);
+
+        LargeBaseObject target;
+        target.base_int_3 = 0;
+        target.base_string_2.clear();
+        size_t consumed = ROP::Deserialize(buffer, target);
+
+        std::cout << "  编码字节数=" << buffer.size() << ", 读取字节数=" << consumed << std::endl;
+        std::cout << "  base_int_3=" << target.base_int_3 << ", base_float_5=" << target.base_float_5
+            << ", base_string_2=" << target.base_string_2 << ", base_bool_2=" << std::boolalpha << target.base_bool_2 << std::endl;
+
+        // 派生类：继承的自定义访问器属性通过setter写回
+        ColumnDerivedObject derived;
+        derived.currentTemp = 36.5f;
+        derived.sampleCount = 12;
+        derived.calibration = 0.75;
+        derived.label = "probe-7";
+
+        buffer.clear();
+        ROP::Serialize(derived, buffer);
+        ColumnDerivedObject restored;
+        ROP::Deserialize(buffer, restored);
+        std::cout << "  ColumnDerivedObject: currentTemp=" << restored.currentTemp << ", sampleCount=" << restored.sampleCount
+            << ", calibration=" << restored.calibration << ", label=" << restored.label
+            << ", setter调用次数=" << restored.calibrationSetCount << std::endl;
+    }
+
+    // 测试3: 多个对象连续写入同一缓冲区
+    {
+        std::cout << "\n测试3: 多个对象连续写入同一缓冲区" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::vector<ColumnTestObject> sources(3);
+        for (int i = 0; i < 3; ++i)
+        {
+            sources[i].sampleCount = i * 10;
+            sources[i].currentTemp = 20.0f + i;
+        }
+
+        ROP::PropertyBinaryBuffer buffer;
+        for (const auto& source : sources)
+        {
+            ROP::Serialize(source, buffer);
+        }
+
+        size_t offset = 0;
+        std::cout << "  读回sampleCount:";
+        for (int i = 0; i < 3; ++i)
+        {
+            ColumnTestObject target;
+            offset += ROP::Deserialize(ROP::PropertySpan<const uint8_t>(buffer.data() + offset, buffer.size() - offset), target);
+            std::cout << " " << target.sampleCount;
+        }
+        std::cout << " (读取 " << offset << "/" << buffer.size() << " 字节)" << std::endl;
+    }
+
+    // 测试4: 不完整的数据
+    {
+        std::cout << "\n测试4: 不完整的数据" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        LargeBaseObject source;
+        ROP::PropertyBinaryBuffer buffer;
+        ROP::Serialize(source, buffer);
+        buffer.resize(buffer.size() - 3);
+
+        LargeBaseObject target;
+        try
+        {
+            ROP::Deserialize(buffer, target);
+            std::cout << "  未检测到截断" << std::endl;
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::cout << "  截断的数据抛出异常: " << e.what() << std::endl;
+        }
+    }
+
+    // 测试5: 性能对比
+    {
+        std::cout << "\n测试5: 性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int objectCount = 10000;
+        std::vector<LargeBaseObject> objects(objectCount);
+        ROP::PropertyBinaryBuffer buffer;
+        buffer.reserve(objectCount * 160);
+
+        // 逐个属性通过名称读取并编码
+        auto start = Clock::now();
+        for (const auto& obj : objects)
+        {
+            for (const auto& meta : obj.GetAllPropertiesList())
+            {
+                auto property = const_cast<LargeBaseObject&>(obj).GetProperty(meta.name);
+                if (meta.typeId == ROP::GetPropertyTypeId<std::string>())
+                    ROP::PropertyBinaryTraits<std::string>::Write(property.GetValue<std::string>(), buffer);
+                else if (meta.typeId == ROP::GetPropertyTypeId<int>())
+                    ROP::PropertyBinaryTraits<int>::Write(property.GetValue<int>(), buffer);
+                else if (meta.typeId == ROP::GetPropertyTypeId<float>())
+                    ROP::PropertyBinaryTraits<float>::Write(property.GetValue<float>(), buffer);
+                else if (meta.typeId == ROP::GetPropertyTypeId<bool>())
+                    ROP::PropertyBinaryTraits<bool>::Write(property.GetValue<bool>(), buffer);
+            }
+        }
+        auto lookupTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+        size_t lookupSize = buffer.size();
+
+        buffer.clear();
+        start = Clock::now();
+        for (const auto& obj : objects)
+        {
+            ROP::Serialize(obj, buffer);
+        }
+        auto planTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::vector<LargeBaseObject> restored(objectCount);
+        start = Clock::now();
+        size_t offset = 0;
+        for (auto& obj : restored)
+        {
+            offset += ROP::Deserialize(ROP::PropertySpan<const uint8_t>(buffer.data() + offset, buffer.size() - offset), obj);
+        }
+        auto readTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::cout << "  对象数: " << objectCount << ", 编码总字节数: " << buffer.size() << " (逐属性编码: " << lookupSize << ")" << std::endl;
+        std::cout << "  逐属性名称查找编码: " << lookupTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  序列化计划编码: " << planTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  序列化计划解码: " << readTime / 1000000.0 << " ms" << std::endl;
+        if (planTime > 0)
+        {
+            std::cout << "  编码加速比: " << static_cast<double>(lookupTime) / planTime << "x" << std::endl;
+        }
+    }
+}
+
+
+void TestJsonReadWrite()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试JSON读写（ToJson/FromJson）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 写出JSON（选项属性输出选项字符串，同名属性只输出子类的）
+    {
+        std::cout << "\n测试1: 写出JSON" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        DerivedObject obj;
+        obj.mode = 2;
+        obj.level = 1;
+        obj.value = -42;
+        obj.tag = "say \"hi\"\n\t\\";
+
+        std::string json;
+        ROP::ToJson(obj, json);
+        std::cout << "  DerivedObject: " << json << std::endl;
+
+        ColumnDerivedObject column;
+        column.currentTemp = 21.5f;
+        column.sampleCount = 3;
+        column.calibration = 0.1;
+        column.label = "sensor";
+        json.clear();
+        ROP::ToJson(column, json);
+        std::cout << "  ColumnDerivedObject: " << json << std::endl;
+    }
+
+    // 测试2: 往返读写
+    {
+        std::cout << "\n测试2: 往返读写" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        DerivedObject source;
+        source.mode = 1;
+        source.level = 2;
+        source.value = 7;
+        source.tag = "round\ttrip";
+        std::string json;
+        ROP::ToJson(source, json);
+
+        DerivedObject target;
+        ROP::FromJson(json, target);
+        std::cout << "  mode=" << target.GetPropertyAsOptional("mode").GetOptionString()
+            << ", level=" << target.GetPropertyAsOptional("level").GetOptionString()
+            << ", value=" << target.value << ", tag相同: " << (target.tag == source.tag ? "是" : "否") << std::endl;
+
+        ColumnDerivedObject column;
+        column.calibration = 0.1;
+        column.currentTemp = 1.0f / 3.0f;
+        json.clear();
+        ROP::ToJson(column, json);
+        ColumnDerivedObject restored;
+        ROP::FromJson(json, restored);
+        std::cout << "  浮点数精确往返: " << (restored.currentTemp == column.currentTemp && restored.calibration == column.calibration ? "是" : "否")
+            << ", calibration setter调用次数=" << restored.calibrationSetCount << std::endl;
+    }
+
+    // 测试3: SAX读取（未知键、空白、转义、null）
+    {
+        std::cout << "\n测试3: SAX读取" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        DerivedObject obj;
+        obj.value = 5;
+        ROP::FromJson(" { \"unknown\" : {\"nested\": [1, 2, {\"x\": null}]},\n \"tag\": \"caf\\u00e9 \\ud83d\\ude00\",\n"
+            " \"value\": null, \"level\": \"High\", \"mode\": \"Super\" } ", obj);
+        std::cout << "  tag=" << obj.tag << ", value=" << obj.value << " (null保持不变), level=" << obj.level << ", mode=" << obj.mode << std::endl;
+    }
+
+    // 测试4: 错误处理
+    {
+        std::cout << "\n测试4: 错误处理" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const char* inputs[] = {
+            "{\"value\": 1.5}",
+            "{\"value\": \"7\"}",
+            "{\"mode\": \"Unknown\"}",
+            "{\"value\": [1]}",
+            "{\"value\": 1,}",
+            "[1, 2]",
+            "{\"value\": 99999999999}",
+        };
+        for (const char* input : inputs)
+        {
+            DerivedObject obj;
+            try
+            {
+                ROP::FromJson(input, obj);
+                std::cout << "  " << input << " -> 成功" << std::endl;
+            }
+            catch (const std::runtime_error& e)
+            {
+                std::cout << "  " << input << " -> " << e.what() << std::endl;
+            }
+        }
+    }
+
+    // 测试5: 性能对比
+    {
+        std::cout << "\n测试5: 性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int objectCount = 10000;
+        std::vector<LargeBaseObject> objects(objectCount);
+
+        // ostringstream逐属性通过名称读取并格式化
+        auto start = Clock::now();
+        size_t streamSize = 0;
+        for (auto& obj : objects)
+        {
+            std::ostringstream oss;
+            oss << "{";
+            bool first = true;
+            for (const auto& meta : obj.GetAllPropertiesList())
+            {
+                oss << (first ? "" : ",") << "\"" << meta.name << "\":";
+                first = false;
+                auto property = obj.GetProperty(meta.name);
+                if (meta.typeId == ROP::GetPropertyTypeId<std::string>())
+                    oss << "\"" << property.GetValue<std::string>() << "\"";
+                else if (meta.typeId == ROP::GetPropertyTypeId<int>())
+                    oss << property.GetValue<int>();
+                else if (meta.typeId == ROP::GetPropertyTypeId<float>())
+                    oss << property.GetValue<float>();
+                else if (meta.typeId == ROP::GetPropertyTypeId<bool>())
+                    oss << (property.GetValue<bool>() ? "true" : "false");
+            }
+            oss << "}";
+            streamSize += oss.str().size();
+        }
+        auto streamTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::string json;
+        std::vector<size_t> offsets;
+        start = Clock::now();
+        for (const auto& obj : objects)
+        {
+            offsets.push_back(json.size());
+            ROP::ToJson(obj, json);
+        }
+        auto writeTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+        offsets.push_back(json.size());
+
+        std::vector<LargeBaseObject> restored(objectCount);
+        start = Clock::now();
+        for (int i = 0; i < objectCount; ++i)
+        {
+            ROP::FromJson(std::string_view(json).substr(offsets[i], offsets[i + 1] - offsets[i]), restored[i]);
+        }
+        auto readTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::cout << "  对象数: " << objectCount << ", JSON总长度: " << json.size() << " (ostringstream: " << streamSize << ")" << std::endl;
+        std::cout << "  ostringstream逐属性格式化: " << streamTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  ToJson: " << writeTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  FromJson: " << readTime / 1000000.0 << " ms" << std::endl;
+        if (writeTime > 0)
+        {
+            std::cout << "  写出加速比: " << static_cast<double>(streamTime) / writeTime << "x" << std::endl;
+        }
+    }
+}
+
+
+// ==================== 带字段标识格式的模式演进测试 ====================
+// 两个命名空间中的同名类模拟同一个类的两个版本（类名相同，因此字段ID相同）
+namespace SnapshotV1
+{
+    class SensorRecord : public ROP::PropertyObject<TestPropertyType>
+    {
+        DECLARE_OBJECT(SensorRecord)
+        registrar
+            .RegisterProperty(TestPropertyType::INT, "id", &SensorRecord::id, "编号")
+            .RegisterProperty(TestPropertyType::STRING, "name", &SensorRecord::name, "名称")
+            .RegisterProperty(TestPropertyType::FLOAT, "reading", &SensorRecord::reading, "读数（V2中删除）");
+        END_DECLARE_OBJECT()
+
+    public:
+        int id = 0;
+        std::string name;
+        float reading = 0.0f;
+    };
+}
+
+namespace SnapshotV2
+{
+    class SensorRecord : public ROP::PropertyObject<TestPropertyType>
+    {
+        DECLARE_OBJECT(SensorRecord)
+        registrar
+            .RegisterProperty(TestPropertyType::STRING, "unit", &SensorRecord::unit, "单位（V2新增）")
+            .RegisterProperty(TestPropertyType::STRING, "name", &SensorRecord::name, "名称")
+            .RegisterProperty(TestPropertyType::CUSTOM_TYPE, "history", &SensorRecord::history, "历史读数（V2新增）")
+            .RegisterProperty(TestPropertyType::INT, "id", &SensorRecord::id, "编号");
+        END_DECLARE_OBJECT()
+
+    public:
+        std::string unit = "C";
+        std::string name;
+        std::vector<double> history;
+        int id = 0;
+    };
+}
+
+// V3把id从int改为int64_t（字段ID不变，值的长度变化）
+namespace SnapshotV3
+{
+    class SensorRecord : public ROP::PropertyObject<TestPropertyType>
+    {
+        DECLARE_OBJECT(SensorRecord)
+        registrar
+            .RegisterProperty(TestPropertyType::INT, "id", &SensorRecord::id, "编号（V3改为int64_t）")
+            .RegisterProperty(TestPropertyType::STRING, "name", &SensorRecord::name, "名称");
+        END_DECLARE_OBJECT()
+
+    public:
+        int64_t id = 0;
+        std::string name;
+    };
+}
+
+void TestTaggedBinaryFormat()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试带字段标识的二进制格式（SerializeTagged/DeserializeTagged）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    // 测试1: 字段ID稳定
+    {
+        std::cout << "\n测试1: 字段ID" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        std::cout << "  SensorRecord.id = 0x" << std::hex << ROP::GetPropertyFieldId("SensorRecord", "id")
+            << ", SensorRecord.name = 0x" << ROP::GetPropertyFieldId("SensorRecord", "name") << std::dec << std::endl;
+        std::cout << "  V1与V2的id字段ID相同: "
+            << (ROP::GetPropertyFieldId(SnapshotV1::SensorRecord().GetClassName(), "id") ==
+                ROP::GetPropertyFieldId(SnapshotV2::SensorRecord().GetClassName(), "id") ? "是" : "否") << std::endl;
+    }
+
+    // 测试2: 旧数据由新版本读取（删除的字段被跳过，新增的字段保持默认值）
+    {
+        std::cout << "\n测试2: V1数据 -> V2对象" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        SnapshotV1::SensorRecord oldRecord;
+        oldRecord.id = 17;
+        oldRecord.name = "boiler";
+        oldRecord.reading = 88.5f;
+
+        ROP::PropertyBinaryBuffer buffer;
+        ROP::SerializeTagged(oldRecord, buffer);
+
+        SnapshotV2::SensorRecord newRecord;
+        size_t consumed = ROP::DeserializeTagged(buffer, newRecord);
+        std::cout << "  读取 " << consumed << "/" << buffer.size() << " 字节: id=" << newRecord.id << ", name=" << newRecord.name
+            << ", unit=" << newRecord.unit << ", history大小=" << newRecord.history.size() << std::endl;
+    }
+
+    // 测试3: 新数据由旧版本读取
+    {
+        std::cout << "\n测试3: V2数据 -> V1对象" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        SnapshotV2::SensorRecord newRecord;
+        newRecord.id = 23;
+        newRecord.name = "chiller";
+        newRecord.unit = "K";
+        newRecord.history = { 1.5, 2.5, 3.5 };
+
+        ROP::PropertyBinaryBuffer buffer;
+        ROP::SerializeTagged(newRecord, buffer);
+        ROP::SerializeTagged(newRecord, buffer);
+
+        SnapshotV1::SensorRecord first;
+        SnapshotV1::SensorRecord second;
+        first.reading = -1.0f;
+        size_t offset = ROP::DeserializeTagged(buffer, first);
+        offset += ROP::DeserializeTagged(ROP::PropertySpan<const uint8_t>(buffer.data() + offset, buffer.size() - offset), second);
+        std::cout << "  连续读取两条记录 " << offset << "/" << buffer.size() << " 字节: id=" << first.id << "/" << second.id
+            << ", name=" << first.name << "/" << second.name << ", reading=" << first.reading << " (保持原值)" << std::endl;
+    }
+
+    // 测试4: 错误处理
+    {
+        std::cout << "\n测试4: 错误处理" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        SnapshotV1::SensorRecord record;
+        record.name = "truncate-me";
+        ROP::PropertyBinaryBuffer buffer;
+        ROP::SerializeTagged(record, buffer);
+
+        auto tryRead = [](const char* label, const ROP::PropertyBinaryBuffer& data)
+            {
+                SnapshotV1::SensorRecord target;
+                try
+                {
+                    ROP::DeserializeTagged(data, target);
+                    std::cout << "  " << label << " -> 成功" << std::endl;
+                }
+                catch (const std::runtime_error& e)
+                {
+                    std::cout << "  " << label << " -> " << e.what() << std::endl;
+                }
+            };
+
+        ROP::PropertyBinaryBuffer truncated(buffer.begin(), buffer.end() - 2);
+        tryRead("截断的记录", truncated);
+
+        ROP::PropertyBinaryBuffer futureVersion = buffer;
+        futureVersion[0] = static_cast<uint8_t>(ROP::PropertyTaggedFormatVersion + 1);
+        tryRead("更高的格式版本", futureVersion);
+
+        // 把第一个字段（id）的值长度改为超出记录末尾
+        ROP::PropertyBinaryBuffer badLength = buffer;
+        const uint32_t wrongLength = 0x10000;
+        std::memcpy(badLength.data() + 12, &wrongLength, sizeof(wrongLength));
+        tryRead("字段长度超出记录", badLength);
+
+        // 字段类型变化：V3的id为int64_t，V1读取时跳过该字段（报告错误），其余字段照常读取
+        SnapshotV3::SensorRecord widened;
+        widened.id = 1234567890123LL;
+        widened.name = "widened";
+        ROP::PropertyBinaryBuffer widenedBuffer;
+        ROP::SerializeTagged(widened, widenedBuffer);
+
+        SnapshotV1::SensorRecord narrow;
+        narrow.id = -1;
+        size_t consumed = ROP::DeserializeTagged(widenedBuffer, narrow);
+        std::cout << "  V3(int64_t id) -> V1(int id): 读取 " << consumed << "/" << widenedBuffer.size() << " 字节, id=" << narrow.id
+            << " (保持原值), name=" << narrow.name << std::endl;
+    }
+
+    // 测试5: 性能对比
+    {
+        std::cout << "\n测试5: 性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const int objectCount = 10000;
+        std::vector<LargeBaseObject> objects(objectCount);
+        std::vector<LargeBaseObject> restored(objectCount);
+
+        ROP::PropertyBinaryBuffer raw;
+        ROP::PropertyBinaryBuffer tagged;
+        auto start = Clock::now();
+        for (const auto& obj : objects)
+        {
+            ROP::Serialize(obj, raw);
+        }
+        auto rawWriteTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (const auto& obj : objects)
+        {
+            ROP::SerializeTagged(obj, tagged);
+        }
+        auto taggedWriteTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        start = Clock::now();
+        size_t offset = 0;
+        for (auto& obj : restored)
+        {
+            offset += ROP::DeserializeTagged(ROP::PropertySpan<const uint8_t>(tagged.data() + offset, tagged.size() - offset), obj);
+        }
+        auto taggedReadTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::cout << "  对象数: " << objectCount << ", 原始格式: " << raw.size() << " 字节, 带标识格式: " << tagged.size() << " 字节" << std::endl;
+        std::cout << "  原始格式编码: " << rawWriteTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  带标识格式编码: " << taggedWriteTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  带标识格式解码: " << taggedReadTime / 1000000.0 << " ms" << std::endl;
+    }
+}
+
+
+void TestMappedPropertyStore()
+{
+    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "测试内存映射的只读对象存储（PropertyMappedStore）" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    using Clock = std::chrono::high_resolution_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    const std::string storePath = "rop_mapped_store_test.bin";
+    const int objectCount = 10000;
+
+    std::vector<std::unique_ptr<LargeBaseObject>> storage;
+    std::vector<LargeBaseObject*> objects;
+    for (int i = 0; i < objectCount; ++i)
+    {
+        storage.push_back(std::make_unique<LargeBaseObject>());
+        storage.back()->base_int_1 = i;
+        storage.back()->base_string_1 = "object_" + std::to_string(i);
+        objects.push_back(storage.back().get());
+    }
+    ROP::PropertyMappedStore<LargeBaseObject>::Write(storePath, objects);
+
+    // 测试1: 打开存储（不解码任何对象）
+    {
+        std::cout << "\n测试1: 打开存储与按需解码" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        ROP::PropertyMappedStore<LargeBaseObject> store(storePath);
+        std::cout << "  对象数: " << store.Size() << ", 已加载对象: " << (store.IsObjectLoaded(1234) ? "是" : "否")
+            << ", 已解码属性数: " << store.GetDecodedPropertyCount() << std::endl;
+
+        auto nameProp = store.GetProperty(1234, "base_string_1");
+        std::cout << "  对象1234的base_string_1=" << nameProp.GetValue<std::string>()
+            << ", 已解码属性数: " << store.GetDecodedPropertyCount() << std::endl;
+
+        // 已解码的属性不会重复解码
+        store.GetProperty(1234, "base_string_1");
+        ROP::PropertyId intId = LargeBaseObject::GetClassPropertyId("base_int_1");
+        std::cout << "  对象1234的base_int_1=" << store.GetPropertyById(1234, intId).GetValue<int>()
+            << ", 已解码属性数: " << store.GetDecodedPropertyCount() << std::endl;
+
+        LargeBaseObject& full = store.GetObject(42);
+        std::cout << "  完整解码对象42: base_int_1=" << full.base_int_1 << ", base_string_1=" << full.base_string_1
+            << ", 已解码属性数: " << store.GetDecodedPropertyCount() << std::endl;
+
+        auto missing = store.GetProperty(7, "no_such_property");
+        std::cout << "  不存在的属性返回无效Property: " << (missing.IsValid() ? "否" : "是") << std::endl;
+    }
+
+    // 测试2: 模式演进（用新版本的类打开旧版本写出的存储）
+    {
+        std::cout << "\n测试2: 模式演进" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        const std::string evolutionPath = "rop_mapped_store_v1.bin";
+        SnapshotV1::SensorRecord oldRecord;
+        oldRecord.id = 9;
+        oldRecord.name = "legacy";
+        std::vector<SnapshotV1::SensorRecord*> oldRecords = { &oldRecord };
+        ROP::PropertyMappedStore<SnapshotV1::SensorRecord>::Write(evolutionPath, oldRecords);
+
+        {
+            ROP::PropertyMappedStore<SnapshotV2::SensorRecord> store(evolutionPath);
+            std::cout << "  V2读取V1存储: id=" << store.GetProperty(0, "id").GetValue<int>()
+                << ", name=" << store.GetProperty(0, "name").GetValue<std::string>()
+                << ", unit=" << store.GetProperty(0, "unit").GetValue<std::string>() << " (默认值)" << std::endl;
+        }
+
+        try
+        {
+            ROP::PropertyMappedStore<ColumnTestObject> wrongType(evolutionPath);
+            std::cout << "  类名不一致未被检测" << std::endl;
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::cout << "  用其他类打开: " << e.what() << std::endl;
+        }
+        std::remove(evolutionPath.c_str());
+    }
+
+    // 测试3: 性能对比
+    {
+        std::cout << "\n测试3: 性能对比" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+
+        // 全量解码：读入整个文件后逐个对象解码所有属性
+        auto start = Clock::now();
+        {
+            std::ifstream file(storePath, std::ios::binary);
+            std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            ROP::PropertyStoreHeader header;
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            std::vector<LargeBaseObject> decoded(objectCount);
+            size_t offset = sizeof(header) + header.classNameLength;
+            for (auto& obj : decoded)
+            {
+                offset += ROP::DeserializeTagged(ROP::PropertySpan<const uint8_t>(bytes.data() + offset, bytes.size() - offset), obj);
+            }
+        }
+        auto eagerTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        start = Clock::now();
+        ROP::PropertyMappedStore<LargeBaseObject> store(storePath);
+        auto openTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        // 只访问1%对象的一个属性
+        start = Clock::now();
+        long long checksum = 0;
+        for (int i = 0; i < objectCount; i += 100)
+        {
+            checksum += store.GetProperty(i, "base_int_1").GetValue<int>();
+        }
+        auto touchTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+
+        std::cout << "  对象数: " << objectCount << ", 校验和: " << checksum << std::endl;
+        std::cout << "  全量读取并解码: " << eagerTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  映射打开: " << openTime / 1000000.0 << " ms" << std::endl;
+        std::cout << "  访问1%对象的一个属性: " << touchTime / 1000000.0 << " ms (解码属性数: " << store.GetDecodedPropertyCount() << ")" << std::endl;
+    }
+
+    std::remove(storePath.c_str());
+}
+
+
 // 主函数
 int main()
 {
@@ -2983,6 +5709,30 @@ int main()
         // 新增测试：自定义字符串类型和自定义错误回调
         TestCustomStringType();
         TestCustomErrorCallback();
+        TestTypedProperty();
+        TestClassPropertyAccessor();
+        TestPropertyIds();
+        TestHeterogeneousLookup();
+        TestPerfectHashLookup();
+        TestMetadataArena();
+        TestSharedParentData();
+        TestPropertyRanges();
+        TestPrecomputedClassQueries();
+        TestZeroCopyReads();
+        TestMoveSetValue();
+        TestTypeIdCheck();
+        TestTryAccess();
+        TestErrorCounters();
+        TestUncheckedAccessPolicy();
+        TestBatchAccess();
+        TestColumnGather();
+        TestColumnScatter();
+        TestPropertyAggregates();
+        TestParallelForEach();
+        TestBinarySerializer();
+        TestJsonReadWrite();
+        TestTaggedBinaryFormat();
+        TestMappedPropertyStore();
 
         std::cout << "\n所有测试完成！" << std::endl;
         return 0;